@@ -0,0 +1,13 @@
+#pragma once
+
+#include "core/chrono/calendar.h"
+
+namespace sandbox {
+// -----------------------------------------------------------------------------
+//  benchmarks
+// -----------------------------------------------------------------------------
+    void calendar_server_benchmark(const egret::chrono::calendar_server& calsrv);
+    void civil_benchmark();
+    void find_interval_benchmark();
+
+} // namespace sandbox
@@ -0,0 +1,54 @@
+#include <format>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/chrono/stopwatch.h"
+#include "benchmarks.h"
+
+namespace sandbox {
+// -----------------------------------------------------------------------------
+//  calendar_server_benchmark
+// -----------------------------------------------------------------------------
+    void calendar_server_benchmark(const egret::chrono::calendar_server& calsrv)
+    {
+        constexpr std::size_t calls_per_thread = 1'000'000;
+        using codes_t = std::set<std::string>;
+        const auto keys = std::vector<egret::chrono::calendar_identifier> {
+            egret::chrono::calendar_identifier(codes_t {"TKY"}),
+            egret::chrono::calendar_identifier(codes_t {"NYK"}),
+            egret::chrono::calendar_identifier(codes_t {"NYK", "TKY"}),
+            egret::chrono::calendar_identifier(codes_t {"NYK", "TKY"}, egret::chrono::calendar_combination::any_open),
+        };
+        // warm up cache
+        calsrv.preload(keys);
+
+        std::cout << "calendar_server::get (cache hit), " << calls_per_thread << " calls per thread" << std::endl;
+        for (const std::size_t n : {1, 2, 4, 8, 16, 32}) {
+            egret::chrono::stopwatch sw;
+            sw.start();
+            {
+                auto threads = std::vector<std::jthread>();
+                threads.reserve(n);
+                for (std::size_t t = 0; t != n; ++t) {
+                    threads.emplace_back([&calsrv, &keys, t] {
+                        std::size_t sum = 0;
+                        for (std::size_t i = 0; i != calls_per_thread; ++i) {
+                            sum += calsrv.get(keys[(i + t) % keys.size()]).additional_holidays().size();
+                        }
+                        volatile auto sink = sum;
+                        (void)sink;
+                    });
+                }
+            }
+            sw.stop();
+            const auto us = sw.microseconds().count();
+            std::cout << std::format(
+                "  threads={:>2}: {:>10}us, {:>8.1f} Mcalls/s", 
+                n, us, static_cast<double>(n * calls_per_thread) / static_cast<double>(us)
+            ) << std::endl;
+        }
+    }
+
+} // namespace sandbox
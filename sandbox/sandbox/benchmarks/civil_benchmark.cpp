@@ -0,0 +1,82 @@
+#include <format>
+#include <iostream>
+#include <vector>
+#include "core/chrono/civil.h"
+#include "core/chrono/stopwatch.h"
+#include "benchmarks.h"
+
+namespace sandbox {
+    namespace {
+        template <typename F>
+        void measure(const char* name, std::size_t n, F f)
+        {
+            egret::chrono::stopwatch sw;
+            sw.start();
+            const auto sink = f();
+            sw.stop();
+            const auto us = sw.microseconds().count();
+            std::cout << std::format(
+                "  {:<32}: {:>8}us, {:>6.2f} ns/date (checksum={})", 
+                name, us, 1000.0 * static_cast<double>(us) / static_cast<double>(n), sink
+            ) << std::endl;
+        }
+
+    } // namespace 
+
+// -----------------------------------------------------------------------------
+//  civil_benchmark
+// -----------------------------------------------------------------------------
+    void civil_benchmark()
+    {
+        constexpr std::size_t n = 10'000'000;
+        auto ds = std::vector<std::chrono::sys_days>(n);
+        for (std::size_t i = 0; i != n; ++i) {
+            // spread over 1900 - 2200 without a regular stride
+            ds[i] = std::chrono::sys_days(std::chrono::days(-25567 + static_cast<std::int32_t>((i * 2654435761u) % 109573u)));
+        }
+
+        std::cout << "sys_days <-> civil date, " << n << " dates" << std::endl;
+        measure("std::chrono::year_month_day", n, [&ds] {
+            std::int64_t sum = 0;
+            for (const auto& d : ds) {
+                const auto ymd = std::chrono::year_month_day(d);
+                sum += std::chrono::sys_days(ymd).time_since_epoch().count() + static_cast<unsigned>(ymd.day());
+            }
+            return sum;
+        });
+        measure("to_civil/from_civil", n, [&ds] {
+            std::int64_t sum = 0;
+            for (const auto& d : ds) {
+                const auto c = egret::chrono::to_civil(d);
+                sum += egret::chrono::from_civil(c).time_since_epoch().count() + c.day;
+            }
+            return sum;
+        });
+
+        std::cout << "d + 3M" << std::endl;
+        measure("std::chrono::year_month_day", n, [&ds] {
+            std::int64_t sum = 0;
+            for (const auto& d : ds) {
+                sum += std::chrono::sys_days(std::chrono::year_month_day(d) + std::chrono::months(3)).time_since_epoch().count();
+            }
+            return sum;
+        });
+        measure("add_months", n, [&ds] {
+            std::int64_t sum = 0;
+            for (const auto& d : ds) {
+                sum += egret::chrono::add_months(d, 3).time_since_epoch().count();
+            }
+            return sum;
+        });
+        measure("add_months (batch)", n, [&ds] {
+            auto result = std::vector<std::chrono::sys_days>(ds.size());
+            egret::chrono::add_months(ds, 3, result);
+            std::int64_t sum = 0;
+            for (const auto& d : result) {
+                sum += d.time_since_epoch().count();
+            }
+            return sum;
+        });
+    }
+
+} // namespace sandbox
@@ -0,0 +1,105 @@
+#include <format>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "core/utils/range_utils/find_interval.h"
+#include "core/utils/range_utils/sorted_vector.h"
+#include "core/math/interp1d/linear.h"
+#include "core/math/interp1d/uniform_grids.h"
+#include "core/chrono/stopwatch.h"
+#include "benchmarks.h"
+
+namespace sandbox {
+    namespace {
+        template <typename F>
+        void measure(const char* name, std::size_t n, F f)
+        {
+            egret::chrono::stopwatch sw;
+            sw.start();
+            const auto sink = f();
+            sw.stop();
+            const auto us = sw.microseconds().count();
+            std::cout << std::format(
+                "  {:<32}: {:>8}us, {:>6.2f} ns/query (checksum={})",
+                name, us, 1000.0 * static_cast<double>(us) / static_cast<double>(n), sink
+            ) << std::endl;
+        }
+
+        template <typename Xs>
+        std::int64_t sum_indices(const Xs& xs, const std::vector<double>& qs)
+        {
+            std::int64_t sum = 0;
+            for (const auto& q : qs) {
+                sum += egret::util::find_interval(xs, q).first - std::ranges::begin(xs);
+            }
+            return sum;
+        }
+
+    } // namespace
+
+// -----------------------------------------------------------------------------
+//  find_interval_benchmark
+// -----------------------------------------------------------------------------
+    void find_interval_benchmark()
+    {
+        namespace util = egret::util;
+        namespace interp1d = egret::math::interp1d;
+        using branchless_grids = util::sorted_vector<double, util::search_layout::branchless>;
+        using eytzinger_grids = util::sorted_vector<double, util::search_layout::eytzinger>;
+
+        constexpr std::size_t n = 2'000'000;
+        constexpr std::size_t knot_counts[] = {8, 64, 512, 4'096, 32'768, 262'144, 1'048'576};
+        auto rng = std::mt19937_64(20240601);
+
+        for (const auto knots : knot_counts) {
+            // year fractions of irregular knots, e.g. daily discount factors with holidays skipped
+            auto xs = std::vector<double>(knots);
+            auto ys = std::vector<double>(knots);
+            auto t = 0.0;
+            for (std::size_t i = 0; i != knots; ++i) {
+                t += (1.0 + static_cast<double>(rng() % 3)) / 365.0;
+                xs[i] = t;
+                ys[i] = 1.0 / (1.0 + 0.01 * t);
+            }
+            auto dist = std::uniform_real_distribution<double>(0.0, t);
+            auto qs = std::vector<double>(n);
+            for (auto& q : qs) {
+                q = dist(rng);
+            }
+
+            const auto branchless = branchless_grids(xs);
+            const auto eytzinger = eytzinger_grids(xs);
+
+            std::cout << "find_interval, " << knots << " knots, " << n << " random queries" << std::endl;
+            measure("std::ranges::lower_bound", n, [&] { return sum_indices(xs, qs); });
+            measure("find_interval_branchless", n, [&] {
+                std::int64_t sum = 0;
+                for (const auto& q : qs) {
+                    sum += util::find_interval_branchless(xs, q).first - xs.begin();
+                }
+                return sum;
+            });
+            measure("sorted_vector (branchless)", n, [&] { return sum_indices(branchless, qs); });
+            measure("sorted_vector (eytzinger)", n, [&] { return sum_indices(eytzinger, qs); });
+
+            const auto f_default = interp1d::generic_linear(xs, ys);
+            const auto f_eytzinger = interp1d::generic_linear(eytzinger, ys);
+            const auto evaluate = [&qs](const auto& f) {
+                auto sum = 0.0;
+                for (const auto& q : qs) {
+                    sum += f(q);
+                }
+                return sum;
+            };
+            measure("generic_linear (std::vector)", n, [&] { return evaluate(f_default); });
+            measure("generic_linear (eytzinger)", n, [&] { return evaluate(f_eytzinger); });
+
+            // equally spaced grids over the same horizon
+            const auto uniform = interp1d::uniform_grids(xs.front(), (t - xs.front()) / static_cast<double>(knots - 1), knots);
+            const auto uniform_xs = uniform.get();
+            measure("std::vector (uniform)", n, [&] { return sum_indices(uniform_xs, qs); });
+            measure("uniform_grids", n, [&] { return sum_indices(uniform, qs); });
+        }
+    }
+
+} // namespace sandbox
@@ -7,6 +7,7 @@
 #include "core/chrono/calendar.h"
 #include "egret/fittings/yc/constraints/any_evaluator.h"
 #include "core/chrono/stopwatch.h"
+#include "benchmarks/benchmarks.h"
 
 namespace  {
     egret::chrono::calendar_server get_calsrv()
@@ -59,6 +60,10 @@ int main()
         std::cout << "5: " << sw.microseconds() << std::endl;
 
         std::cout << egret::cpt::yield_curve_evaluator<decltype(objxx), std::string, egret::model::any_yield_curve<double>> << std::endl;
+
+        sandbox::calendar_server_benchmark(calsrv);
+        sandbox::civil_benchmark();
+        sandbox::find_interval_benchmark();
         //const auto any = egret::fit::yc::any_evaluator<double, std::string>(obj2);
     }
     catch (const egret::exception& e) {
@@ -9,3 +9,4 @@
 #include "calendars/redundant_calendar_source.h"
 #include "calendars/json_map_calendar_source.h"
 #include "calendars/json_directory_calendar_source.h"
+#include "calendars/binary_calendar_source.h"
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "core/auto_link.h"
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include "any_calendar_source.h"
+#include "json_directory_calendar_source.h"
+
+namespace egret::chrono {
+// -----------------------------------------------------------------------------
+//  [class] binary_calendar_source
+// -----------------------------------------------------------------------------
+    /**
+     * @brief calendar source backed by a memory-mapped binary snapshot file.
+     * @details
+     *  the file is written by write_binary_calendar_snapshot and laid out as
+     *      header    : magic "EGRETCAL", version (u32), number of codes (u32)
+     *      directory : entries sorted by code. 
+     *                  code offset (u64), code size (u32), holidays count (u32), 
+     *                  holidays offset (u64), businessdays offset (u64), businessdays count (u32), reserved (u32)
+     *      payload   : codes and sorted day counts since 1970-01-01 (i32)
+     *  all integers are little endian. the mapping is read-only and shared by copies.
+     *  the directory is validated to be strictly increasing by code on load.
+    */
+    class binary_calendar_source {
+    private:
+        using this_type = binary_calendar_source;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        binary_calendar_source() = delete;
+        binary_calendar_source(const this_type&) noexcept = default;
+        binary_calendar_source(this_type&&) noexcept = default;
+
+        explicit binary_calendar_source(const std::filesystem::path& path);
+
+        this_type& operator =(const this_type&) noexcept = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  calendar source behavior
+    //
+        std::optional<std::vector<std::chrono::sys_days>> get_additional_holidays(std::string_view code) const;
+        std::optional<std::vector<std::chrono::sys_days>> get_additional_businessdays(std::string_view code) const;
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        /**
+         * @brief codes in the snapshot in ascending order, copied out of the mapping.
+        */
+        std::vector<std::string> codes() const;
+
+    private:
+        struct mapping;
+        std::shared_ptr<const mapping> mapping_;
+
+    }; // class binary_calendar_source
+
+// -----------------------------------------------------------------------------
+//  [fn] write_binary_calendar_snapshot
+// -----------------------------------------------------------------------------
+    /**
+     * @brief write calendars of codes in src into a snapshot file readable by binary_calendar_source.
+    */
+    void write_binary_calendar_snapshot(
+        const std::filesystem::path& path, 
+        const any_calendar_source& src, 
+        std::span<const std::string> codes
+    );
+
+    /**
+     * @brief convert all '{code}{ext}' files in the directory of src into a snapshot file.
+    */
+    void write_binary_calendar_snapshot(const std::filesystem::path& path, const json_directory_calendar_source& src);
+
+} // namespace egret::chrono
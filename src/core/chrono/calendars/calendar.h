@@ -3,7 +3,9 @@
 #include "core/auto_link.h"
 #include <vector>
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <nlohmann/json_fwd.hpp>
 #include "core/assertions/exception.h"
 #include "core/utils/json_utils/j2obj.h"
@@ -43,6 +45,15 @@ namespace egret::chrono {
         bool is_holiday(const std::chrono::sys_days& d) const;
         bool is_businessday(const std::chrono::sys_days& d) const;
 
+        /**
+         * @brief classify dates at once.
+         * @details
+         *  bit (i % 64) of mask[i / 64] is set iff ds[i] is a holiday (businessday, respectively).
+         *  mask must have (ds.size() + 63) / 64 elements at least. unused bits are cleared.
+        */
+        void is_holiday(std::span<const std::chrono::sys_days> ds, std::span<std::uint64_t> mask) const;
+        void is_businessday(std::span<const std::chrono::sys_days> ds, std::span<std::uint64_t> mask) const;
+
     // -------------------------------------------------------------------------
     //  get
     //
@@ -50,7 +61,25 @@ namespace egret::chrono {
         const std::vector<std::chrono::sys_days>& additional_holidays() const noexcept;
         const std::vector<std::chrono::sys_days>& additional_businessdays() const noexcept;
 
+    // -------------------------------------------------------------------------
+    //  compare
+    //
+        /**
+         * @brief same identifier and same additional days. copies sharing their data compare in O(1).
+        */
+        bool operator ==(const this_type& other) const noexcept;
+
     private:
+        friend std::size_t count_businessdays(const calendar&, const std::chrono::sys_days&, const std::chrono::sys_days&);
+        friend std::chrono::sys_days add_businessdays(const calendar&, const std::chrono::sys_days&, std::int_fast32_t);
+        friend std::chrono::sys_days next_businessday(const calendar&, const std::chrono::sys_days&);
+        friend std::chrono::sys_days prev_businessday(const calendar&, const std::chrono::sys_days&);
+        friend void count_businessdays(
+            const calendar&, 
+            std::span<const std::chrono::sys_days>, std::span<const std::chrono::sys_days>, 
+            std::span<std::size_t>
+        );
+
         std::shared_ptr<const impl> impl_;
 
     }; // class calendar
@@ -64,6 +93,16 @@ namespace egret::chrono {
         const std::chrono::sys_days& to
     );
 
+    /**
+     * @brief count businessdays in [froms[i], tos[i]) for each i into result[i].
+    */
+    void count_businessdays(
+        const calendar& cal,
+        std::span<const std::chrono::sys_days> froms,
+        std::span<const std::chrono::sys_days> tos,
+        std::span<std::size_t> result
+    );
+
 // -----------------------------------------------------------------------------
 //  [fn] count_holidays
 // -----------------------------------------------------------------------------
@@ -72,6 +111,33 @@ namespace egret::chrono {
         const std::chrono::sys_days& from,
         const std::chrono::sys_days& to
     );
+
+// -----------------------------------------------------------------------------
+//  [fn] add_businessdays
+// -----------------------------------------------------------------------------
+    /**
+     * @brief shift date by businessdays.
+     * @details
+     *  for positive count, returns the count-th businessday strictly after d.
+     *  for negative count, returns the |count|-th businessday strictly before d.
+     *  d itself does not need to be a businessday. zero count returns d as is.
+    */
+    std::chrono::sys_days add_businessdays(
+        const calendar& cal,
+        const std::chrono::sys_days& d,
+        std::int_fast32_t count
+    );
+
+// -----------------------------------------------------------------------------
+//  [fn] next_businessday
+//  [fn] prev_businessday
+// -----------------------------------------------------------------------------
+    /**
+     * @brief the first businessday on or after d (the last one on or before d, respectively).
+     * @details a few word scans of the holiday bitmap, independent of the length of holidays.
+    */
+    std::chrono::sys_days next_businessday(const calendar& cal, const std::chrono::sys_days& d);
+    std::chrono::sys_days prev_businessday(const calendar& cal, const std::chrono::sys_days& d);
     
 } // namespace egret::chrono
 
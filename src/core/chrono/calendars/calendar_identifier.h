@@ -1,11 +1,16 @@
 #pragma once
 
 #include "core/auto_link.h"
+#include <cstdint>
 #include <set>
+#include <span>
+#include <vector>
 #include <ranges>
 #include <string>
+#include <string_view>
 #include <array>
 #include <compare>
+#include <tuple>
 #include <nlohmann/json_fwd.hpp>
 #include "core/utils/json_utils/j2obj.h"
 #include "core/utils/string_utils/string_value_map_of.h"
@@ -29,25 +34,69 @@ namespace egret::chrono {
     }
 
 // -----------------------------------------------------------------------------
-//  [struct] calendar_identifier
+//  [fn] intern_calendar_code
 // -----------------------------------------------------------------------------
-    struct calendar_identifier {
-        std::set<std::string> codes;
-        calendar_combination combination = calendar_combination::all_open;
+    /**
+     * @brief get process-wide unique id of calendar code. thread-safe.
+     * @details the same code always returns the same id.
+    */
+    std::uint32_t intern_calendar_code(std::string_view code);
 
-        constexpr auto operator ==(const calendar_identifier& other) const
+// -----------------------------------------------------------------------------
+//  [class] calendar_identifier
+// -----------------------------------------------------------------------------
+    class calendar_identifier {
+    private:
+        using this_type = calendar_identifier;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        calendar_identifier();
+        calendar_identifier(const this_type&) = default;
+        calendar_identifier(this_type&&) noexcept = default;
+
+        calendar_identifier(std::set<std::string> codes, calendar_combination combination = calendar_combination::all_open);
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        const std::set<std::string>& codes() const noexcept { return codes_; }
+        calendar_combination combination() const noexcept { return combination_; }
+
+        /**
+         * @brief interned ids of codes, in the order of codes().
+        */
+        std::span<const std::uint32_t> ids() const noexcept { return ids_; }
+
+        /**
+         * @brief precomputed 64-bit fingerprint of ids and combination.
+        */
+        std::uint64_t hash() const noexcept { return hash_; }
+
+    // -------------------------------------------------------------------------
+    //  comparison
+    //
+        bool operator ==(const this_type& other) const noexcept
         {
-            return codes.size() < 2 && codes.size() == other.codes.size()
-                ? codes == other.codes
-                : std::tie(codes, combination) == std::tie(other.codes, other.combination);
+            return hash_ == other.hash_ && combination_ == other.combination_ && ids_ == other.ids_;
         }
-        constexpr auto operator<=>(const calendar_identifier& other) const
+        std::strong_ordering operator <=>(const this_type& other) const
         {
-            return codes.size() < 2 && codes.size() == other.codes.size()
-                ? codes <=> other.codes
-                : std::tie(codes, combination) <=> std::tie(other.codes, other.combination);
+            return std::tie(codes_, combination_) <=> std::tie(other.codes_, other.combination_);
         }
-    };
+
+    private:
+        std::set<std::string> codes_;
+        calendar_combination combination_; // normalized to all_open if codes_.size() < 2
+        std::vector<std::uint32_t> ids_;
+        std::uint64_t hash_;
+
+    }; // class calendar_identifier
 
 } // namespace egret::chrono
 
@@ -70,9 +119,20 @@ namespace nlohmann {
         template <typename Json>
         static void to_json(Json& j, const egret::chrono::calendar_identifier& key)
         {
-            j["codes"] = key.codes;
-            j["combination_type"] = key.combination;
+            j["codes"] = key.codes();
+            j["combination_type"] = key.combination();
+        }
+    };
+
+} // namespace nlohmann
+
+namespace std {
+    template <>
+    struct hash<egret::chrono::calendar_identifier> {
+        std::size_t operator()(const egret::chrono::calendar_identifier& key) const noexcept
+        {
+            return static_cast<std::size_t>(key.hash());
         }
     };
 
-} // namespace nlohmann
\ No newline at end of file
+} // namespace std
\ No newline at end of file
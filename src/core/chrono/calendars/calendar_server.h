@@ -1,9 +1,14 @@
 #pragma once
 
 #include "core/auto_link.h"
+#include <cstdint>
 #include <memory>
 #include <map>
 #include <mutex>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
 #include "calendar.h"
 #include "calendar_identifier.h"
 #include "any_calendar_source.h"
@@ -30,11 +35,58 @@ namespace egret::chrono {
         this_type& operator =(const this_type&) noexcept = default;
         this_type& operator =(this_type&&) noexcept = default;
 
+    // -------------------------------------------------------------------------
+    //  reload
+    //
+        /**
+         * @brief switch to a new generation of calendar source.
+         * @details
+         *  cached calendars are rebuilt from src before the new generation is published atomically.
+         *  readers are never blocked and calendars already obtained keep the old data.
+         *  if updated_codes is given, only calendars depending on those codes are rebuilt.
+         *  src is called from worker threads, so that the calendar source must be safe to read concurrently.
+        */
+        void reload(any_calendar_source src) const;
+        void reload(any_calendar_source src, std::span<const std::string> updated_codes) const;
+
+        /**
+         * @brief generation number. incremented by each reload.
+        */
+        std::uint64_t version() const noexcept;
+
     // -------------------------------------------------------------------------
     //  get
     //
+        /**
+         * @brief get calendar identified by key. thread-safe.
+         * @details
+         *  cache hits only read an immutable snapshot; misses are serialized and loaded on the calling thread.
+         *  a miss publishes a snapshot sharing the cached calendars of the previous one instead of copying them.
+        */
         calendar get(const calendar_identifier& key) const;
 
+        /**
+         * @brief build calendars of keys up-front, in parallel.
+         * @details 
+         *  already cached keys are skipped. the built calendars are published at once.
+         *  the calendar source is called from worker threads, so that it must be safe to read concurrently.
+        */
+        void preload(std::span<const calendar_identifier> keys) const;
+
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, const calendar_identifier&>
+        void preload(R&& keys) const
+        {
+            if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R> 
+                && std::same_as<std::ranges::range_value_t<R>, calendar_identifier>) {
+                this->preload(std::span<const calendar_identifier>(std::ranges::data(keys), std::ranges::size(keys)));
+            }
+            else {
+                const auto ids = std::forward<R>(keys) | std::ranges::to<std::vector<calendar_identifier>>();
+                this->preload(std::span<const calendar_identifier>(ids));
+            }
+        }
+
     private:
         std::shared_ptr<impl> impl_;
 
@@ -2,6 +2,9 @@
 
 #include "core/auto_link.h"
 #include <vector>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <chrono>
 #include <optional>
 #include <filesystem>
@@ -15,6 +18,9 @@ namespace egret::chrono {
      * @details
      *  directory is assumed to have '{calendar_name}.json' files
      *  where the json files are assumed to obey calendar_source.schema.json.
+     *  parsed days are cached per code. the timestamp of a cached file is checked 
+     *  at most once per check_interval (one second by default), or never if check_interval is std::nullopt.
+     *  a missing file is cached as well, so that with std::nullopt a file added later is never picked up.
     */
     class json_directory_calendar_source {
     private:
@@ -28,7 +34,11 @@ namespace egret::chrono {
         json_directory_calendar_source(const this_type&) = default;
         json_directory_calendar_source(this_type&&) = default;
 
-        json_directory_calendar_source(std::filesystem::path directory_path, std::string ext) noexcept;
+        json_directory_calendar_source(
+            std::filesystem::path directory_path, 
+            std::string ext, 
+            std::optional<std::chrono::seconds> check_interval = std::chrono::seconds(1)
+        ) noexcept;
         explicit json_directory_calendar_source(std::filesystem::path directory_path);
 
         this_type& operator =(const this_type&) = default;
@@ -45,10 +55,12 @@ namespace egret::chrono {
     //
         const auto& directory_path() const noexcept { return dirpath_; }
         const auto& file_extention() const noexcept { return ext_; }
+        const auto& check_interval() const noexcept { return check_interval_; }
 
     private:
         std::filesystem::path dirpath_;
         std::string ext_;
+        std::optional<std::chrono::seconds> check_interval_;
 
         struct cache;
         std::shared_ptr<cache> cache_;
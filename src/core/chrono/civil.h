@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include "core/assertions/assertion.h"
+
+namespace egret::chrono {
+// -----------------------------------------------------------------------------
+//  [struct] civil_date
+// -----------------------------------------------------------------------------
+    /**
+     * @brief plain year/month/day triple used by the fast conversion kernels.
+     * @details
+     *  unlike std::chrono::year_month_day, fields are raw integers and day may exceed the month length; 
+     *  from_civil then overflows into the following month(s), as sys_days(year_month_day) does.
+    */
+    struct civil_date {
+        std::int32_t year;
+        std::uint32_t month;
+        std::uint32_t day;
+
+        friend constexpr bool operator ==(const civil_date&, const civil_date&) = default;
+    };
+
+} // namespace egret::chrono
+
+namespace egret_detail::civil_impl {
+    // Neri and Schneider, "Euclidean affine functions and their application to calendar algorithms" (2022).
+    // the epoch is shifted by 82 * 400 years so that every intermediate is unsigned.
+    inline constexpr std::uint32_t shift = 82;
+    inline constexpr std::uint32_t shift_days = 719468 + 146097 * shift;
+    inline constexpr std::uint32_t shift_years = 400 * shift;
+
+} // namespace egret_detail::civil_impl
+
+namespace egret::chrono {
+// -----------------------------------------------------------------------------
+//  [fn] is_leap_year
+//  [fn] last_day_of_month
+// -----------------------------------------------------------------------------
+    constexpr bool is_leap_year(std::int32_t y) noexcept
+    {
+        // divisible by 4, or by 16 if divisible by 100 (i.e. by 400)
+        return (y & (y % 25 == 0 ? 15 : 3)) == 0;
+    }
+
+    constexpr std::uint32_t last_day_of_month(std::int32_t y, std::uint32_t m) noexcept
+    {
+        return m != 2 ? 30 | ((m ^ (m >> 3)) & 1) : 28 + static_cast<std::uint32_t>(is_leap_year(y));
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] to_civil
+//  [fn] from_civil
+// -----------------------------------------------------------------------------
+    constexpr civil_date to_civil(const std::chrono::sys_days& d) noexcept
+    {
+        namespace impl = egret_detail::civil_impl;
+        const auto n = static_cast<std::uint32_t>(d.time_since_epoch().count()) + impl::shift_days;
+
+        // century and day of century
+        const auto n1 = 4 * n + 3;
+        const auto c = n1 / 146097;
+        const auto nc = n1 % 146097 / 4;
+
+        // year of century and day of year (starting March 1st)
+        const auto n2 = 4 * nc + 3;
+        const auto p2 = std::uint64_t(2939745) * n2;
+        const auto z = static_cast<std::uint32_t>(p2 >> 32);
+        const auto ny = static_cast<std::uint32_t>(p2) / 2939745 / 4;
+
+        // month and day
+        const auto n3 = 2141 * ny + 197913;
+        const auto m = n3 >> 16;
+        const auto dd = (n3 & 0xFFFF) / 2141;
+
+        const auto j = static_cast<std::uint32_t>(ny >= 306);
+        return {
+            .year = static_cast<std::int32_t>(100 * c + z + j) - static_cast<std::int32_t>(impl::shift_years),
+            .month = j ? m - 12 : m,
+            .day = dd + 1,
+        };
+    }
+
+    constexpr std::chrono::sys_days from_civil(std::int32_t y, std::uint32_t m, std::uint32_t d) noexcept
+    {
+        namespace impl = egret_detail::civil_impl;
+        const auto j = static_cast<std::uint32_t>(m <= 2);
+        const auto y1 = static_cast<std::uint32_t>(y + static_cast<std::int32_t>(impl::shift_years)) - j;
+        const auto m1 = j ? m + 12 : m;
+        const auto c = y1 / 100;
+        const auto ys = 1461 * y1 / 4 - c + c / 4;
+        const auto ms = (979 * m1 - 2919) / 32;
+        const auto n = ys + ms + d - 1;
+        return std::chrono::sys_days(std::chrono::days(static_cast<std::int32_t>(n - impl::shift_days)));
+    }
+
+    constexpr std::chrono::sys_days from_civil(const civil_date& c) noexcept
+    {
+        return chrono::from_civil(c.year, c.month, c.day);
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] add_months
+// -----------------------------------------------------------------------------
+    /**
+     * @brief shift year and month. day is kept as is, even if it exceeds the month length.
+    */
+    constexpr civil_date add_months(const civil_date& c, std::int32_t months) noexcept
+    {
+        const auto total = c.year * 12 + static_cast<std::int32_t>(c.month) - 1 + months;
+        const auto y = (total >= 0 ? total : total - 11) / 12;
+        return {.year = y, .month = static_cast<std::uint32_t>(total - y * 12 + 1), .day = c.day};
+    }
+
+    /**
+     * @brief d + months with the same day overflow as std::chrono::year_month_day arithmetic.
+    */
+    constexpr std::chrono::sys_days add_months(const std::chrono::sys_days& d, std::int32_t months) noexcept
+    {
+        return chrono::from_civil(chrono::add_months(chrono::to_civil(d), months));
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] to_civil (batch)
+//  [fn] from_civil (batch)
+//  [fn] add_months (batch)
+// -----------------------------------------------------------------------------
+    inline void to_civil(std::span<const std::chrono::sys_days> ds, std::span<civil_date> result)
+    {
+        assertion(ds.size() <= result.size(), "Result is too short. [dates.size={}, result.size={}]", ds.size(), result.size());
+        for (std::size_t i = 0; i != ds.size(); ++i) {
+            result[i] = chrono::to_civil(ds[i]);
+        }
+    }
+
+    inline void from_civil(std::span<const civil_date> cs, std::span<std::chrono::sys_days> result)
+    {
+        assertion(cs.size() <= result.size(), "Result is too short. [dates.size={}, result.size={}]", cs.size(), result.size());
+        for (std::size_t i = 0; i != cs.size(); ++i) {
+            result[i] = chrono::from_civil(cs[i]);
+        }
+    }
+
+    inline void add_months(std::span<const std::chrono::sys_days> ds, std::int32_t months, std::span<std::chrono::sys_days> result)
+    {
+        assertion(ds.size() <= result.size(), "Result is too short. [dates.size={}, result.size={}]", ds.size(), result.size());
+        for (std::size_t i = 0; i != ds.size(); ++i) {
+            result[i] = chrono::add_months(ds[i], months);
+        }
+    }
+
+} // namespace egret::chrono
@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ranges>
+#include "core/assertions/exception.h"
+#include "../calendars/binary_calendar_source.h"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace egret::chrono {
+    namespace {
+        static_assert(std::endian::native == std::endian::little, "binary calendar snapshot assumes little endian.");
+
+        constexpr char _magic[8] = {'E', 'G', 'R', 'E', 'T', 'C', 'A', 'L'};
+        constexpr std::uint32_t _version = 1;
+        constexpr std::size_t _header_size = 16;
+
+        struct _entry {
+            std::uint64_t code_offset;
+            std::uint32_t code_size;
+            std::uint32_t hols_count;
+            std::uint64_t hols_offset;
+            std::uint64_t bds_offset;
+            std::uint32_t bds_count;
+            std::uint32_t reserved;
+        };
+        static_assert(sizeof(_entry) == 40);
+
+        template <typename T>
+        T _read(const std::byte* p) noexcept
+        {
+            T result;
+            std::memcpy(&result, p, sizeof(T));
+            return result;
+        }
+
+        std::vector<std::chrono::sys_days> _to_days(const std::byte* p, std::uint32_t count)
+        {
+            auto result = std::vector<std::chrono::sys_days>(count);
+            for (std::uint32_t i = 0; i != count; ++i) {
+                result[i] = std::chrono::sys_days(std::chrono::days(_read<std::int32_t>(p + sizeof(std::int32_t) * i)));
+            }
+            return result;
+        }
+
+        template <typename T>
+        void _write(std::ofstream& ofs, const T& value)
+        {
+            ofs.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+    } // namespace 
+
+// -----------------------------------------------------------------------------
+//  [class] binary_calendar_source
+// -----------------------------------------------------------------------------
+    struct binary_calendar_source::mapping {
+        const std::byte* data = nullptr;
+        std::size_t size = 0;
+        std::uint32_t count = 0;
+#if defined(_WIN32)
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE map = nullptr;
+#endif
+
+        mapping() = default;
+        mapping(const mapping&) = delete;
+        mapping& operator =(const mapping&) = delete;
+
+        ~mapping()
+        {
+#if defined(_WIN32)
+            if (data) {
+                ::UnmapViewOfFile(data);
+            }
+            if (map) {
+                ::CloseHandle(map);
+            }
+            if (file != INVALID_HANDLE_VALUE) {
+                ::CloseHandle(file);
+            }
+#else
+            if (data) {
+                ::munmap(const_cast<std::byte*>(data), size);
+            }
+#endif
+        }
+
+        _entry entry(std::uint32_t i) const noexcept
+        {
+            return _read<_entry>(data + _header_size + sizeof(_entry) * i);
+        }
+        std::string_view code(const _entry& e) const noexcept
+        {
+            return {reinterpret_cast<const char*>(data + e.code_offset), e.code_size};
+        }
+        std::optional<_entry> find(std::string_view code) const noexcept
+        {
+            // binary search over sorted directory
+            std::uint32_t lo = 0;
+            std::uint32_t hi = count;
+            while (lo < hi) {
+                const auto mid = lo + (hi - lo) / 2;
+                const auto e = this->entry(mid);
+                if (const auto c = this->code(e); c < code) {
+                    lo = mid + 1;
+                }
+                else if (code < c) {
+                    hi = mid;
+                }
+                else {
+                    return e;
+                }
+            }
+            return std::nullopt;
+        }
+    };
+
+    binary_calendar_source::binary_calendar_source(const std::filesystem::path& path)
+        : mapping_()
+    {
+        auto m = std::make_shared<mapping>();
+        const auto size = std::filesystem::file_size(path);
+        if (size < _header_size) {
+            throw exception("Calendar snapshot file is too small. [path={}, size={}]", path.string(), size);
+        }
+#if defined(_WIN32)
+        m->file = ::CreateFileW(
+            path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+        if (m->file == INVALID_HANDLE_VALUE) {
+            throw exception("Fail to open calendar snapshot file. [path={}]", path.string());
+        }
+        m->map = ::CreateFileMappingW(m->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m->map) {
+            throw exception("Fail to map calendar snapshot file. [path={}]", path.string());
+        }
+        m->data = static_cast<const std::byte*>(::MapViewOfFile(m->map, FILE_MAP_READ, 0, 0, 0));
+        if (!m->data) {
+            throw exception("Fail to map calendar snapshot file. [path={}]", path.string());
+        }
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw exception("Fail to open calendar snapshot file. [path={}]", path.string());
+        }
+        void* p = ::mmap(nullptr, static_cast<std::size_t>(size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            throw exception("Fail to map calendar snapshot file. [path={}]", path.string());
+        }
+        m->data = static_cast<const std::byte*>(p);
+#endif
+        m->size = static_cast<std::size_t>(size);
+
+        // validate
+        if (std::memcmp(m->data, _magic, sizeof(_magic)) != 0) {
+            throw exception("File is not a calendar snapshot. [path={}]", path.string());
+        }
+        if (const auto version = _read<std::uint32_t>(m->data + 8); version != _version) {
+            throw exception("Unsupported calendar snapshot version. [path={}, version={}]", path.string(), version);
+        }
+        m->count = _read<std::uint32_t>(m->data + 12);
+        // whether count elements of elem_size bytes from offset lie in the file. never overflows even for corrupted fields.
+        const auto fits = [size = std::uint64_t(m->size)](std::uint64_t offset, std::uint64_t count, std::uint64_t elem_size) {
+            return offset <= size && count <= (size - offset) / elem_size;
+        };
+        if (!fits(_header_size, m->count, sizeof(_entry))) {
+            throw exception("Calendar snapshot file is truncated. [path={}]", path.string());
+        }
+        for (std::uint32_t i = 0; i != m->count; ++i) {
+            const auto e = m->entry(i);
+            const bool valid = fits(e.code_offset, e.code_size, 1)
+                && fits(e.hols_offset, e.hols_count, sizeof(std::int32_t))
+                && fits(e.bds_offset, e.bds_count, sizeof(std::int32_t));
+            if (!valid) {
+                throw exception("Calendar snapshot file is truncated. [path={}]", path.string());
+            }
+            // find() relies on binary search over the directory
+            if (i != 0 && !(m->code(m->entry(i - 1)) < m->code(e))) {
+                throw exception("Calendar snapshot directory is not sorted by code. [path={}, code={}]", path.string(), m->code(e));
+            }
+        }
+        mapping_ = std::move(m);
+    }
+
+    auto binary_calendar_source::get_additional_holidays(std::string_view code) const
+        -> std::optional<std::vector<std::chrono::sys_days>>
+    {
+        const auto e = mapping_->find(code);
+        return e ? std::make_optional(_to_days(mapping_->data + e->hols_offset, e->hols_count)) : std::nullopt;
+    }
+
+    auto binary_calendar_source::get_additional_businessdays(std::string_view code) const
+        -> std::optional<std::vector<std::chrono::sys_days>>
+    {
+        const auto e = mapping_->find(code);
+        return e ? std::make_optional(_to_days(mapping_->data + e->bds_offset, e->bds_count)) : std::nullopt;
+    }
+
+    std::vector<std::string> binary_calendar_source::codes() const
+    {
+        return std::views::iota(std::uint32_t(0), mapping_->count)
+            | std::views::transform([this](std::uint32_t i) { return std::string(mapping_->code(mapping_->entry(i))); })
+            | std::ranges::to<std::vector>();
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] write_binary_calendar_snapshot
+// -----------------------------------------------------------------------------
+    void write_binary_calendar_snapshot(
+        const std::filesystem::path& path, 
+        const any_calendar_source& src, 
+        std::span<const std::string> codes
+    )
+    {
+        auto sorted_codes = std::vector<std::string>(codes.begin(), codes.end());
+        std::ranges::sort(sorted_codes);
+        const auto [first, last] = std::ranges::unique(sorted_codes);
+        sorted_codes.erase(first, last);
+
+        struct data_t {
+            std::vector<std::chrono::sys_days> hols;
+            std::vector<std::chrono::sys_days> bds;
+        };
+        auto data = std::vector<data_t>();
+        data.reserve(sorted_codes.size());
+        for (const auto& code : sorted_codes) {
+            auto hols = src.get_additional_holidays(code);
+            auto bds = src.get_additional_businessdays(code);
+            if (!hols || !bds) {
+                throw exception("Calendar source does not have data for \"{}\"", code);
+            }
+            std::ranges::sort(*hols);
+            std::ranges::sort(*bds);
+            data.emplace_back(*std::move(hols), *std::move(bds));
+        }
+
+        // layout: header, directory, day arrays (4-byte aligned), codes
+        auto entries = std::vector<_entry>(sorted_codes.size());
+        std::uint64_t offset = _header_size + sizeof(_entry) * entries.size();
+        for (std::size_t i = 0; i != entries.size(); ++i) {
+            entries[i].hols_offset = offset;
+            entries[i].hols_count = static_cast<std::uint32_t>(data[i].hols.size());
+            offset += sizeof(std::int32_t) * data[i].hols.size();
+            entries[i].bds_offset = offset;
+            entries[i].bds_count = static_cast<std::uint32_t>(data[i].bds.size());
+            offset += sizeof(std::int32_t) * data[i].bds.size();
+            entries[i].reserved = 0;
+        }
+        for (std::size_t i = 0; i != entries.size(); ++i) {
+            entries[i].code_offset = offset;
+            entries[i].code_size = static_cast<std::uint32_t>(sorted_codes[i].size());
+            offset += sorted_codes[i].size();
+        }
+
+        auto ofs = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        if (!ofs.is_open()) {
+            throw exception("Fail to open calendar snapshot file for writing. [path={}]", path.string());
+        }
+        ofs.write(_magic, sizeof(_magic));
+        _write(ofs, _version);
+        _write(ofs, static_cast<std::uint32_t>(entries.size()));
+        for (const auto& e : entries) {
+            _write(ofs, e);
+        }
+        for (const auto& [hols, bds] : data) {
+            for (const auto& d : hols) {
+                _write(ofs, static_cast<std::int32_t>(d.time_since_epoch().count()));
+            }
+            for (const auto& d : bds) {
+                _write(ofs, static_cast<std::int32_t>(d.time_since_epoch().count()));
+            }
+        }
+        for (const auto& code : sorted_codes) {
+            ofs.write(code.data(), static_cast<std::streamsize>(code.size()));
+        }
+        if (!ofs) {
+            throw exception("Fail to write calendar snapshot file. [path={}]", path.string());
+        }
+    }
+
+    void write_binary_calendar_snapshot(const std::filesystem::path& path, const json_directory_calendar_source& src)
+    {
+        auto codes = std::vector<std::string>();
+        for (const auto& entry : std::filesystem::directory_iterator(src.directory_path())) {
+            if (entry.is_regular_file() && entry.path().extension() == src.file_extention()) {
+                codes.push_back(entry.path().stem().string());
+            }
+        }
+        write_binary_calendar_snapshot(path, any_calendar_source(src), codes);
+    }
+
+} // namespace egret::chrono
@@ -1,10 +1,13 @@
 #include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <vector>
 #include <format>
 #include <ranges>
 #include <nlohmann/json.hpp>
 #include "core/assertions/exception.h"
 #include "core/assertions/assertion.h"
+#include "core/config.h"
 #include "core/utils/string_utils/parse.h"
 #include "core/utils/string_utils/to_string.h"
 #include "../calendars/calendar.h"
@@ -66,6 +69,177 @@ namespace egret::chrono {
             return !_is_weekend(d);
         };
 
+// -----------------------------------------------------------------------------
+//  [struct] _holiday_bitmap
+// -----------------------------------------------------------------------------
+        /**
+         * @brief dense holiday flags over [front, front + size).
+         * @details
+         *  bit i is set iff front + i is a holiday. 
+         *  the window covers whole years around the additional holiday/businessday data
+         *  extended by config::calendar_bitmap_horizon on both sides.
+         *  
+         *  ranks and selects are succinct indices over businessdays (cleared bits),
+         *  so that counting and stepping businessdays in the window are done by index arithmetic.
+        */
+        struct _holiday_bitmap {
+            std::chrono::sys_days front = {};
+            std::uint32_t size = 0;
+            std::vector<std::uint64_t> bits = {};
+            std::vector<std::uint32_t> ranks = {};      // ranks[w]: number of businessdays in [front, front + 64w)
+            std::vector<std::uint32_t> selects = {};    // selects[k]: word index which contains the (64k)-th businessday
+
+            bool contains(const std::chrono::sys_days& d) const noexcept
+            {
+                return static_cast<std::uint32_t>((d - front).count()) < size;
+            }
+            bool contains_as_end(const std::chrono::sys_days& d) const noexcept
+            {
+                return static_cast<std::uint32_t>((d - front).count()) <= size;
+            }
+            bool test(const std::chrono::sys_days& d) const noexcept
+            {
+                const auto i = static_cast<std::uint32_t>((d - front).count());
+                return (bits[i >> 6] >> (i & 63)) & 1u;
+            }
+            void set(const std::chrono::sys_days& d, bool flag) noexcept
+            {
+                const auto i = static_cast<std::uint32_t>((d - front).count());
+                const auto mask = std::uint64_t(1) << (i & 63);
+                bits[i >> 6] = flag ? (bits[i >> 6] | mask) : (bits[i >> 6] & ~mask);
+            }
+
+            // number of businessdays in [front, d). d must satisfy contains_as_end(d).
+            std::uint32_t rank(const std::chrono::sys_days& d) const noexcept
+            {
+                const auto i = static_cast<std::uint32_t>((d - front).count());
+                const auto w = i >> 6;
+                const auto b = i & 63;
+                if (b == 0) {
+                    return ranks[w];
+                }
+                const auto mask = (std::uint64_t(1) << b) - 1;
+                return ranks[w] + static_cast<std::uint32_t>(std::popcount(~bits[w] & mask));
+            }
+            std::uint32_t businessday_count() const noexcept
+            {
+                return ranks.empty() ? 0 : ranks.back();
+            }
+
+            // offset of the first businessday in [i, size), or size if none. i must be less than size.
+            std::uint32_t next_businessday(std::uint32_t i) const noexcept
+            {
+                auto w = i >> 6;
+                auto x = ~bits[w] & (~std::uint64_t(0) << (i & 63));
+                while (x == 0) {
+                    if (++w == bits.size()) {
+                        return size;
+                    }
+                    x = ~bits[w];
+                }
+                // padding bits are holidays, so the result never exceeds size
+                return w * 64 + static_cast<std::uint32_t>(std::countr_zero(x));
+            }
+
+            // offset + 1 of the last businessday in [0, i], or 0 if none. i must be less than size.
+            std::uint32_t prev_businessday(std::uint32_t i) const noexcept
+            {
+                auto w = i >> 6;
+                auto x = ~bits[w] & (~std::uint64_t(0) >> (63 - (i & 63)));
+                while (x == 0) {
+                    if (w == 0) {
+                        return 0;
+                    }
+                    x = ~bits[--w];
+                }
+                return w * 64 + 64 - static_cast<std::uint32_t>(std::countl_zero(x));
+            }
+
+            // k-th (0-origin) businessday in the window. k must be less than businessday_count().
+            std::chrono::sys_days select(std::uint32_t k) const noexcept
+            {
+                auto w = selects[k >> 6];
+                while (ranks[w + 1] <= k) {
+                    ++w;
+                }
+                auto x = ~bits[w];
+                for (auto r = k - ranks[w]; r != 0; --r) {
+                    x &= x - 1;
+                }
+                return front + std::chrono::days(w * 64 + static_cast<std::uint32_t>(std::countr_zero(x)));
+            }
+        };
+
+        _holiday_bitmap _build_holiday_bitmap(
+            const std::vector<std::chrono::sys_days>& additional_hols,
+            const std::vector<std::chrono::sys_days>& additional_bds
+        )
+        {
+            if (additional_hols.empty() && additional_bds.empty()) {
+                // weekday rule only. no need to have bitmap.
+                return {};
+            }
+            const auto [lo, hi] = [&additional_hols, &additional_bds] {
+                if (additional_hols.empty()) {
+                    return std::pair {additional_bds.front(), additional_bds.back()};
+                }
+                if (additional_bds.empty()) {
+                    return std::pair {additional_hols.front(), additional_hols.back()};
+                }
+                return std::pair {
+                    std::min(additional_hols.front(), additional_bds.front()),
+                    std::max(additional_hols.back(), additional_bds.back())
+                };
+            }();
+            const auto fst_year = std::chrono::year_month_day(lo).year() - config::calendar_bitmap_horizon;
+            const auto lst_year = std::chrono::year_month_day(hi).year() + config::calendar_bitmap_horizon;
+            const auto front = std::chrono::sys_days(fst_year / std::chrono::January / 1);
+            const auto back = std::chrono::sys_days(lst_year / std::chrono::December / 31);
+
+            _holiday_bitmap result {
+                .front = front,
+                .size = static_cast<std::uint32_t>((back - front).count() + 1),
+            };
+            const std::size_t words = (result.size + 63) / 64;
+            result.bits.resize(words, 0);
+
+            // weekends
+            const auto fst_sat = front + (std::chrono::Saturday - std::chrono::weekday(front));
+            for (auto d = fst_sat; d <= back; d += std::chrono::weeks(1)) {
+                result.set(d, true);
+                if (d + std::chrono::days(1) <= back) {
+                    result.set(d + std::chrono::days(1), true);
+                }
+            }
+            if (std::chrono::weekday(front) == std::chrono::Sunday) {
+                result.set(front, true);
+            }
+
+            // additional holidays and businessdays. they are within the window by construction.
+            for (const auto& d : additional_hols) {
+                result.set(d, true);
+            }
+            for (const auto& d : additional_bds) {
+                result.set(d, false);
+            }
+
+            // padding bits after the window are regarded as holidays so that they are never counted.
+            if (const auto tail = result.size & 63; tail != 0) {
+                result.bits.back() |= ~((std::uint64_t(1) << tail) - 1);
+            }
+
+            // rank/select indices
+            result.ranks.resize(words + 1, 0);
+            for (std::size_t w = 0; w != words; ++w) {
+                const auto cnt = static_cast<std::uint32_t>(std::popcount(~result.bits[w]));
+                for (auto k = (result.ranks[w] + 63) / 64 * 64; k < result.ranks[w] + cnt; k += 64) {
+                    result.selects.push_back(static_cast<std::uint32_t>(w));
+                }
+                result.ranks[w + 1] = result.ranks[w] + cnt;
+            }
+            return result;
+        }
+
     } // namespace 
 
 // -----------------------------------------------------------------------------
@@ -75,6 +249,7 @@ namespace egret::chrono {
         calendar_identifier identifier;
         std::vector<std::chrono::sys_days> additional_hols;
         std::vector<std::chrono::sys_days> additional_bds;
+        _holiday_bitmap holiday_bitmap = _build_holiday_bitmap(additional_hols, additional_bds);
     };
 
 // -----------------------------------------------------------------------------
@@ -97,6 +272,11 @@ namespace egret::chrono {
 
     bool calendar::is_holiday(const std::chrono::sys_days& d) const
     {
+        const auto& bitmap = impl_->holiday_bitmap;
+        if (bitmap.contains(d)) [[likely]] {
+            return bitmap.test(d);
+        }
+        // out of precomputed window
         const auto wd = std::chrono::weekday(d);
         const auto is_weekday = wd != std::chrono::Saturday && wd != std::chrono::Sunday;
         if (is_weekday) [[likely]] {
@@ -111,10 +291,82 @@ namespace egret::chrono {
         return !this->is_holiday(d);
     }
 
+    void calendar::is_holiday(std::span<const std::chrono::sys_days> ds, std::span<std::uint64_t> mask) const
+    {
+        const auto n = ds.size();
+        const auto words = (n + 63) / 64;
+        assertion(
+            words <= mask.size(),
+            "Mask is too short to classify dates. [dates.size={}, mask.size={}]", n, mask.size()
+        );
+        std::ranges::fill(mask, std::uint64_t(0));
+
+        const auto& bitmap = impl_->holiday_bitmap;
+        if (bitmap.bits.empty()) {
+            // no additional days. weekend rule only
+            for (std::size_t w = 0; w != words; ++w) {
+                const auto base = w * 64;
+                const auto m = std::min<std::size_t>(64, n - base);
+                std::uint64_t word = 0;
+                for (std::size_t j = 0; j != m; ++j) {
+                    // c_encoding of weekday. 1970-01-01 is Thursday
+                    const auto dc = ds[base + j].time_since_epoch().count();
+                    const auto wd = (dc % 7 + 11) % 7;
+                    word |= static_cast<std::uint64_t>(wd == 0 || wd == 6) << j;
+                }
+                mask[w] = word;
+            }
+            return;
+        }
+
+        const auto* bits = bitmap.bits.data();
+        for (std::size_t w = 0; w != words; ++w) {
+            const auto base = w * 64;
+            const auto m = std::min<std::size_t>(64, n - base);
+            std::uint64_t word = 0;
+            std::uint64_t outside = 0;
+            for (std::size_t j = 0; j != m; ++j) {
+                const auto i = static_cast<std::uint32_t>((ds[base + j] - bitmap.front).count());
+                const bool in = i < bitmap.size;
+                const auto k = in ? i : 0u;
+                const auto flag = (bits[k >> 6] >> (k & 63)) & static_cast<std::uint64_t>(in);
+                word |= flag << j;
+                outside |= static_cast<std::uint64_t>(!in) << j;
+            }
+            // out of precomputed window
+            for (; outside != 0; outside &= outside - 1) {
+                const auto j = static_cast<std::size_t>(std::countr_zero(outside));
+                word |= static_cast<std::uint64_t>(this->is_holiday(ds[base + j])) << j;
+            }
+            mask[w] = word;
+        }
+    }
+    void calendar::is_businessday(std::span<const std::chrono::sys_days> ds, std::span<std::uint64_t> mask) const
+    {
+        this->is_holiday(ds, mask);
+        const auto n = ds.size();
+        const auto words = (n + 63) / 64;
+        for (std::size_t w = 0; w != words; ++w) {
+            mask[w] = ~mask[w];
+        }
+        if (const auto tail = n & 63; tail != 0) {
+            mask[words - 1] &= (std::uint64_t(1) << tail) - 1;
+        }
+    }
+
     const calendar_identifier& calendar::identifier() const noexcept { return impl_->identifier; }
     const std::vector<std::chrono::sys_days>& calendar::additional_holidays() const noexcept { return impl_->additional_hols; }
     const std::vector<std::chrono::sys_days>& calendar::additional_businessdays() const noexcept { return impl_->additional_bds; }
 
+    bool calendar::operator ==(const this_type& other) const noexcept
+    {
+        return impl_ == other.impl_ || (
+            impl_->identifier == other.impl_->identifier &&
+            impl_->additional_hols == other.impl_->additional_hols &&
+            impl_->additional_bds == other.impl_->additional_bds
+        );
+    }
+
 // -----------------------------------------------------------------------------
 //  [fn] count_businessdays
 // -----------------------------------------------------------------------------
@@ -129,6 +381,9 @@ namespace egret::chrono {
         if (from == to) {
             return 0;
         }
+        if (const auto& bitmap = cal.impl_->holiday_bitmap; bitmap.contains_as_end(from) && bitmap.contains_as_end(to)) [[likely]] {
+            return bitmap.rank(to) - bitmap.rank(from);
+        }
         const std::size_t unadjusted_count = [&from, &to] {
             const auto from_wd = std::chrono::weekday(from);
             const auto to_wd = std::chrono::weekday(to);
@@ -148,6 +403,28 @@ namespace egret::chrono {
             - std::ranges::distance(std::ranges::lower_bound(sp_holdays, from), std::ranges::lower_bound(sp_holdays, to));
     }
     
+    void count_businessdays(
+        const calendar& cal,
+        std::span<const std::chrono::sys_days> froms,
+        std::span<const std::chrono::sys_days> tos,
+        std::span<std::size_t> result
+    )
+    {
+        assertion(
+            froms.size() == tos.size() && froms.size() <= result.size(),
+            "Sizes of arguments are inconsistent. [froms.size={}, tos.size={}, result.size={}]",
+            froms.size(), tos.size(), result.size()
+        );
+        const auto& bitmap = cal.impl_->holiday_bitmap;
+        for (std::size_t i = 0; i != froms.size(); ++i) {
+            const auto& from = froms[i];
+            const auto& to = tos[i];
+            result[i] = from <= to && bitmap.contains_as_end(from) && bitmap.contains_as_end(to)
+                ? bitmap.rank(to) - bitmap.rank(from)
+                : chrono::count_businessdays(cal, from, to);
+        }
+    }
+    
 // -----------------------------------------------------------------------------
 //  [fn] count_holidays
 // -----------------------------------------------------------------------------
@@ -165,4 +442,84 @@ namespace egret::chrono {
         return static_cast<std::size_t>((to - from).count()) - chrono::count_businessdays(cal, from, to);
     }
     
-} // namespace egret::chrono
+// -----------------------------------------------------------------------------
+//  [fn] add_businessdays
+// -----------------------------------------------------------------------------
+    std::chrono::sys_days add_businessdays(const calendar& cal, const std::chrono::sys_days& d, std::int_fast32_t count)
+    {
+        if (count == 0) {
+            return d;
+        }
+        const auto& bitmap = cal.impl_->holiday_bitmap;
+        if (bitmap.contains(d)) [[likely]] {
+            if (0 < count) {
+                // businessdays in [front, d] are skipped
+                const auto target = static_cast<std::int_fast64_t>(bitmap.rank(d + std::chrono::days(1))) + count - 1;
+                if (target < bitmap.businessday_count()) [[likely]] {
+                    return bitmap.select(static_cast<std::uint32_t>(target));
+                }
+            }
+            else {
+                const auto target = static_cast<std::int_fast64_t>(bitmap.rank(d)) + count;
+                if (0 <= target) [[likely]] {
+                    return bitmap.select(static_cast<std::uint32_t>(target));
+                }
+            }
+        }
+
+        // out of precomputed window
+        auto result = d;
+        if (0 < count) {
+            for (auto remained = count; remained != 0; --remained) {
+                result = next_businessday(cal, result + std::chrono::days(1));
+            }
+        }
+        else {
+            for (auto remained = count; remained != 0; ++remained) {
+                result = prev_businessday(cal, result - std::chrono::days(1));
+            }
+        }
+        return result;
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] next_businessday
+//  [fn] prev_businessday
+// -----------------------------------------------------------------------------
+    std::chrono::sys_days next_businessday(const calendar& cal, const std::chrono::sys_days& d)
+    {
+        auto result = d;
+        const auto& bitmap = cal.impl_->holiday_bitmap;
+        if (bitmap.contains(d)) [[likely]] {
+            const auto i = bitmap.next_businessday(static_cast<std::uint32_t>((d - bitmap.front).count()));
+            result = bitmap.front + std::chrono::days(i);
+            if (i < bitmap.size) [[likely]] {
+                return result;
+            }
+        }
+        // out of precomputed window. only weekends are holidays there.
+        while (cal.is_holiday(result)) {
+            result += std::chrono::days(1);
+        }
+        return result;
+    }
+
+    std::chrono::sys_days prev_businessday(const calendar& cal, const std::chrono::sys_days& d)
+    {
+        auto result = d;
+        const auto& bitmap = cal.impl_->holiday_bitmap;
+        if (bitmap.contains(d)) [[likely]] {
+            const auto i = bitmap.prev_businessday(static_cast<std::uint32_t>((d - bitmap.front).count()));
+            result = bitmap.front + std::chrono::days(i) - std::chrono::days(1);
+            if (i != 0) [[likely]] {
+                return result;
+            }
+        }
+        // out of precomputed window. only weekends are holidays there.
+        while (cal.is_holiday(result)) {
+            result -= std::chrono::days(1);
+        }
+        return result;
+    }
+    
+} // namespace egret::chrono
\ No newline at end of file
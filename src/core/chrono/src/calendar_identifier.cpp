@@ -0,0 +1,71 @@
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include "../calendars/calendar_identifier.h"
+
+namespace egret::chrono {
+    namespace {
+        // splitmix64 finalizer
+        constexpr std::uint64_t _mix(std::uint64_t x) noexcept
+        {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        struct _code_registry {
+            std::map<std::string, std::uint32_t, std::less<>> ids;
+            std::shared_mutex mutex;
+        };
+
+        _code_registry& _get_code_registry()
+        {
+            static _code_registry registry;
+            return registry;
+        }
+
+    } // namespace 
+
+// -----------------------------------------------------------------------------
+//  [fn] intern_calendar_code
+// -----------------------------------------------------------------------------
+    std::uint32_t intern_calendar_code(std::string_view code)
+    {
+        auto& registry = _get_code_registry();
+        {
+            const auto _ = std::shared_lock<std::shared_mutex>(registry.mutex);
+            if (const auto it = registry.ids.find(code); it != registry.ids.end()) [[likely]] {
+                return it->second;
+            }
+        }
+        const auto _ = std::lock_guard<std::shared_mutex>(registry.mutex);
+        const auto id = static_cast<std::uint32_t>(registry.ids.size());
+        return registry.ids.try_emplace(std::string(code), id).first->second;
+    }
+
+// -----------------------------------------------------------------------------
+//  [class] calendar_identifier
+// -----------------------------------------------------------------------------
+    calendar_identifier::calendar_identifier()
+        : calendar_identifier(std::set<std::string> {})
+    {
+    }
+
+    calendar_identifier::calendar_identifier(std::set<std::string> codes, calendar_combination combination)
+        : codes_(std::move(codes)), 
+          combination_(codes_.size() < 2 ? calendar_combination::all_open : combination),
+          ids_(),
+          hash_(_mix(static_cast<std::uint64_t>(combination_) + 1))
+    {
+        ids_.reserve(codes_.size());
+        for (const auto& code : codes_) {
+            const auto id = intern_calendar_code(code);
+            ids_.push_back(id);
+            hash_ = _mix(hash_ ^ (static_cast<std::uint64_t>(id) + 0x9e3779b97f4a7c15ull));
+        }
+    }
+
+} // namespace egret::chrono
@@ -1,17 +1,21 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <thread>
 #include <ranges>
-#include <numeric>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
 #include "../calendars/calendar_server.h"
 
 namespace egret::chrono {
     namespace {
         // single calendar
-        calendar get_calendar(const any_calendar_source& src, std::map<std::string, calendar>& map, const std::string& code)
+        calendar load_calendar(const any_calendar_source& src, const std::string& code)
         {
-            if (map.contains(code)) {
-                return map.at(code);
-            }
-
             auto add_hols = [&src, &code] {
                 auto maybe_add_hols = src.get_additional_holidays(code);
                 return maybe_add_hols 
@@ -24,81 +28,194 @@ namespace egret::chrono {
                     ? *std::move(maybe_add_bds)
                     : throw exception("Calendar source does not have additional business day data for \"{}\"", code);
             }();
+            return calendar(calendar_identifier(std::set<std::string> {code}), std::move(add_hols), std::move(add_bds));
+        }
 
-            // create result, register into cache and return it
-            auto result = calendar({.codes = {code}},  std::move(add_hols), std::move(add_bds));
-            map.emplace(code, result);
+        // k-way merge of sorted days. keep days contained in at least min_count lists
+        std::vector<std::chrono::sys_days> merge_days(
+            std::span<const std::vector<std::chrono::sys_days>* const> lists, 
+            std::size_t min_count
+        )
+        {
+            auto heads = lists 
+                | std::views::transform([](const auto* list) { return std::span<const std::chrono::sys_days>(*list); })
+                | std::ranges::to<std::vector>();
+            const auto sizes = heads | std::views::transform([](const auto& head) { return head.size(); });
+            std::vector<std::chrono::sys_days> result;
+            result.reserve(min_count <= 1 ? std::ranges::fold_left(sizes, std::size_t(0), std::plus<>()) : std::ranges::min(sizes));
+            while (true) {
+                const std::chrono::sys_days* front = nullptr;
+                for (const auto& head : heads) {
+                    if (!head.empty() && (!front || head.front() < *front)) {
+                        front = &head.front();
+                    }
+                }
+                if (!front) {
+                    break;
+                }
+                const auto d = *front;
+                std::size_t count = 0;
+                for (auto& head : heads) {
+                    if (!head.empty() && head.front() == d) {
+                        head = head.subspan(1);
+                        ++count;
+                    }
+                }
+                if (count >= min_count) {
+                    result.push_back(d);
+                }
+            }
             return result;
         }
 
         // combined calendar
-        calendar get_calendar(
-            const any_calendar_source& src,
-            std::map<std::string, calendar>& single_map,
-            std::map<calendar_identifier, calendar>& map, 
-            const calendar_identifier& key
-        )
+        calendar combine_calendars(const calendar_identifier& key, std::span<const calendar* const> calendars)
         {
-            if (map.contains(key)) {
-                return map.at(key);
+            const auto hols = calendars 
+                | std::views::transform([](const calendar* cal) { return &cal->additional_holidays(); }) 
+                | std::ranges::to<std::vector>();
+            const auto bds = calendars 
+                | std::views::transform([](const calendar* cal) { return &cal->additional_businessdays(); }) 
+                | std::ranges::to<std::vector>();
+
+            // all_open: holiday if any is holiday. any_open: holiday if all are holidays.
+            switch (key.combination()) {
+            case calendar_combination::all_open:
+                return calendar(key, merge_days(hols, 1), merge_days(bds, calendars.size()));
+            case calendar_combination::any_open:
+                return calendar(key, merge_days(hols, calendars.size()), merge_days(bds, 1));
             }
+            std::unreachable();
+        }
 
-            const auto calendars = key.codes 
-                | std::views::transform([&src, &single_map](const auto& code) { 
-                    return get_calendar(src, single_map, code); 
-                })
-                | std::ranges::to<std::vector>();
+        // run f(0), ..., f(n - 1) on worker threads, or on the caller thread unless parallel. the first exception is rethrown.
+        template <typename F>
+        void parallel_for(std::size_t n, F f, bool parallel)
+        {
+            const auto concurrency = std::max(1u, std::thread::hardware_concurrency());
+            const auto n_workers = parallel ? std::min<std::size_t>(n, concurrency) : std::size_t(1);
+            if (n_workers <= 1) {
+                for (std::size_t i = 0; i != n; ++i) {
+                    f(i);
+                }
+                return;
+            }
 
-            std::vector<std::chrono::sys_days> add_hols;
-            std::vector<std::chrono::sys_days> add_bds;
-            std::vector<std::chrono::sys_days> prev_add_hols {};
-            std::vector<std::chrono::sys_days> prev_add_bds {};
+            std::atomic<std::size_t> next = 0;
+            std::exception_ptr error = nullptr;
+            std::mutex error_mutex;
+            {
+                auto workers = std::vector<std::jthread>();
+                workers.reserve(n_workers);
+                for (std::size_t w = 0; w != n_workers; ++w) {
+                    workers.emplace_back([&] {
+                        for (auto i = next.fetch_add(1); i < n; i = next.fetch_add(1)) {
+                            try {
+                                f(i);
+                            }
+                            catch (...) {
+                                const auto _ = std::lock_guard<std::mutex>(error_mutex);
+                                if (!error) {
+                                    error = std::current_exception();
+                                }
+                                next = n;
+                            }
+                        }
+                    });
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
 
-            // reserve memory
+        // open-addressing table of calendars. linear probing over interned identifier hash
+        class calendar_table {
+        public:
+            const calendar* find(const calendar_identifier& key) const noexcept
             {
-                const auto hol_cals_szs = calendars | std::views::transform([](const auto& cal) { return cal.additional_holidays().size(); });
-                const auto bd_cals_szs  = calendars | std::views::transform([](const auto& cal) { return cal.additional_businessdays().size(); });
+                if (slots_.empty()) {
+                    return nullptr;
+                }
+                const auto mask = slots_.size() - 1;
+                for (auto i = static_cast<std::size_t>(key.hash()) & mask; slots_[i] != 0; i = (i + 1) & mask) {
+                    if (const auto& [k, cal] = entries_[slots_[i] - 1]; k == key) {
+                        return &cal;
+                    }
+                }
+                return nullptr;
+            }
 
-                switch (key.combination) {
-                case calendar_combination::all_open:
-                    add_hols.reserve(std::accumulate(hol_cals_szs.begin(), hol_cals_szs.end(), static_cast<std::size_t>(0)));
-                    add_bds.reserve(std::ranges::max(bd_cals_szs));
-                    break;
-                case calendar_combination::any_open:
-                    add_hols.reserve(std::ranges::max(hol_cals_szs));
-                    add_bds.reserve(std::accumulate(bd_cals_szs.begin(), bd_cals_szs.end(), static_cast<std::size_t>(0)));
-                    break;
-                default:
-                    break;
+            void insert(const calendar_identifier& key, calendar cal)
+            {
+                entries_.emplace_back(key, std::move(cal));
+                // keep load factor <= 1/2
+                if (slots_.size() < 2 * entries_.size()) {
+                    slots_.assign(std::max<std::size_t>(16, slots_.size() * 2), 0);
+                    for (std::uint32_t n = 0; n != entries_.size(); ++n) {
+                        this->place(n);
+                    }
+                }
+                else {
+                    this->place(static_cast<std::uint32_t>(entries_.size() - 1));
                 }
-                prev_add_hols.reserve(add_hols.capacity());
-                prev_add_bds.reserve(add_bds.capacity());
             }
 
-            // intersect/union with remained calendars
-            for (const auto& cal : calendars) {
-                add_hols.clear();
-                add_bds.clear();
-                switch (key.combination) {
-                case calendar_combination::all_open:
-                    std::ranges::set_union(prev_add_hols, cal.additional_holidays(), std::back_inserter(add_hols));
-                    std::ranges::set_intersection(prev_add_bds, cal.additional_businessdays(), std::back_inserter(add_bds));
-                    break;
-                case calendar_combination::any_open:
-                    std::ranges::set_intersection(prev_add_hols, cal.additional_holidays(), std::back_inserter(add_hols));
-                    std::ranges::set_union(prev_add_bds, cal.additional_businessdays(), std::back_inserter(add_bds));
-                    break;
-                default:
-                    break;
+            std::span<const std::pair<calendar_identifier, calendar>> entries() const noexcept { return entries_; }
+
+        private:
+            void place(std::uint32_t n) noexcept
+            {
+                const auto mask = slots_.size() - 1;
+                auto i = static_cast<std::size_t>(entries_[n].first.hash()) & mask;
+                while (slots_[i] != 0) {
+                    i = (i + 1) & mask;
                 }
-                prev_add_hols = add_hols;
-                prev_add_bds = add_bds;
+                slots_[i] = n + 1;
             }
 
-            auto result = calendar(key, std::move(add_hols), std::move(add_bds));
-            map.emplace(key, result);
-            return result;
-        }
+            std::vector<std::pair<calendar_identifier, calendar>> entries_;
+            std::vector<std::uint32_t> slots_; // 0: empty, otherwise index of entries_ + 1
+        };
+
+        // immutable levels of calendar_table shared between generations. sizes decrease like a binary counter, 
+        // so that appending calendars copies O(log N) level pointers and each calendar is re-inserted O(log N) times.
+        class calendar_levels {
+        public:
+            const calendar* find(const calendar_identifier& key) const noexcept
+            {
+                for (const auto& level : levels_) {
+                    if (const auto* cal = level->find(key)) {
+                        return cal;
+                    }
+                }
+                return nullptr;
+            }
+
+            void append(calendar_table table)
+            {
+                if (table.entries().empty()) {
+                    return;
+                }
+                while (!levels_.empty() && levels_.back()->entries().size() <= table.entries().size()) {
+                    auto merged = calendar_table();
+                    for (const auto& [key, cal] : levels_.back()->entries()) {
+                        merged.insert(key, cal);
+                    }
+                    for (const auto& [key, cal] : table.entries()) {
+                        merged.insert(key, cal);
+                    }
+                    table = std::move(merged);
+                    levels_.pop_back();
+                }
+                levels_.push_back(std::make_shared<const calendar_table>(std::move(table)));
+            }
+
+            std::span<const std::shared_ptr<const calendar_table>> levels() const noexcept { return levels_; }
+
+        private:
+            std::vector<std::shared_ptr<const calendar_table>> levels_; // largest first
+        };
 
     } // namespace 
 
@@ -106,10 +223,125 @@ namespace egret::chrono {
 //  [class] calendar_server
 // -----------------------------------------------------------------------------
     struct calendar_server::impl {
-        const any_calendar_source src;
+        // one generation of the server. immutable once published. readers only load the pointer.
+        struct snapshot_type {
+            any_calendar_source src;
+            std::uint64_t version;
+            calendar_levels table;
+        };
+
+        std::atomic<std::shared_ptr<const snapshot_type>> snapshot;
+
+        // guarded by mutex. single calendars of the current generation
         std::map<std::string, calendar> single_cache;
-        std::map<calendar_identifier, calendar> cache;
         std::mutex mutex;
+
+        explicit impl(any_calendar_source src)
+            : snapshot(std::make_shared<const snapshot_type>(std::move(src), 0, calendar_levels {}))
+        {
+        }
+
+        // build calendars of keys missing in both cached and added from src into added. mutex must be locked.
+        // worker threads are spawned only if parallel, i.e. for bulk loads and not for a miss of get.
+        void load(
+            const any_calendar_source& src, 
+            const calendar_levels& cached, 
+            calendar_table& added, 
+            std::span<const calendar_identifier* const> keys, 
+            bool parallel
+        )
+        {
+            auto missing = std::vector<const calendar_identifier*>();
+            for (const auto* key : keys) {
+                const auto is_new = !key->codes().empty()
+                    && !cached.find(*key)
+                    && !added.find(*key)
+                    && std::ranges::none_of(missing, [key](const auto* m) { return *m == *key; });
+                if (is_new) {
+                    missing.push_back(key);
+                }
+            }
+            if (missing.empty()) {
+                return;
+            }
+
+            // single calendars
+            auto codes = std::vector<const std::string*>();
+            for (const auto* key : missing) {
+                for (const auto& code : key->codes()) {
+                    if (!single_cache.contains(code) && std::ranges::none_of(codes, [&code](const auto* c) { return *c == code; })) {
+                        codes.push_back(&code);
+                    }
+                }
+            }
+            auto singles = std::vector<calendar>(codes.size());
+            parallel_for(codes.size(), [&](std::size_t i) { singles[i] = load_calendar(src, *codes[i]); }, parallel);
+            for (std::size_t i = 0; i != codes.size(); ++i) {
+                single_cache.emplace(*codes[i], std::move(singles[i]));
+            }
+
+            // combined calendars
+            auto results = std::vector<calendar>(missing.size());
+            parallel_for(missing.size(), [&](std::size_t i) {
+                const auto& key = *missing[i];
+                const auto calendars = key.codes()
+                    | std::views::transform([this](const auto& code) { return &single_cache.at(code); })
+                    | std::ranges::to<std::vector>();
+                results[i] = calendars.size() == 1 ? *calendars.front() : combine_calendars(key, calendars);
+            }, parallel);
+            for (std::size_t i = 0; i != missing.size(); ++i) {
+                added.insert(*missing[i], std::move(results[i]));
+            }
+        }
+
+        // load missing calendars in the current generation and publish them at once. mutex must be locked.
+        // the levels of the current table are shared with the next snapshot, so that a miss does not copy the whole table.
+        void load(std::span<const calendar_identifier* const> keys, bool parallel)
+        {
+            const auto current = snapshot.load(std::memory_order_acquire);
+            auto added = calendar_table();
+            this->load(current->src, current->table, added, keys, parallel);
+            if (added.entries().empty()) {
+                return;
+            }
+            auto next = std::make_shared<snapshot_type>(*current);
+            next->table.append(std::move(added));
+            snapshot.store(std::move(next), std::memory_order_release);
+        }
+
+        // switch to new generation. mutex must be locked.
+        void reload(any_calendar_source src, std::optional<std::span<const std::string>> updated_codes)
+        {
+            const auto current = snapshot.load(std::memory_order_acquire);
+            const auto is_updated = [&updated_codes](const calendar_identifier& key) {
+                return !updated_codes || std::ranges::any_of(key.codes(), [&updated_codes](const auto& code) {
+                    return std::ranges::find(*updated_codes, code) != updated_codes->end();
+                });
+            };
+
+            // keep calendars not depending on updated codes
+            auto next = std::make_shared<snapshot_type>(std::move(src), current->version + 1, calendar_levels {});
+            auto kept = calendar_table();
+            auto invalidated = std::vector<const calendar_identifier*>();
+            for (const auto& level : current->table.levels()) {
+                for (const auto& [key, cal] : level->entries()) {
+                    if (is_updated(key)) {
+                        invalidated.push_back(&key);
+                    }
+                    else {
+                        kept.insert(key, cal);
+                    }
+                }
+            }
+            std::erase_if(single_cache, [&updated_codes](const auto& kv) {
+                return !updated_codes || std::ranges::find(*updated_codes, kv.first) != updated_codes->end();
+            });
+
+            // rewarm invalidated calendars before publishing, so that readers never see a cold cache
+            this->load(next->src, next->table, kept, invalidated, true);
+            next->table.append(std::move(kept));
+            snapshot.store(std::move(next), std::memory_order_release);
+        }
     };
 
     calendar_server::calendar_server(any_calendar_source src)
@@ -119,16 +351,46 @@ namespace egret::chrono {
 
     calendar calendar_server::get(const calendar_identifier& key) const
     {
-        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
-
-        switch (key.codes.size()) {
-        case 0:
+        if (key.codes().empty()) {
             return calendar(key, {}, {});
-        case 1:
-            return get_calendar(impl_->src, impl_->single_cache, (*key.codes.begin()));        
-        default:
-            return get_calendar(impl_->src, impl_->single_cache, impl_->cache, key);
         }
+
+        // hit: lock-free
+        if (const auto snapshot = impl_->snapshot.load(std::memory_order_acquire); const auto* cal = snapshot->table.find(key)) [[likely]] {
+            return *cal;
+        }
+
+        // miss: serialized
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        const auto* p = &key;
+        impl_->load(std::span(&p, 1), false);
+        return *impl_->snapshot.load(std::memory_order_acquire)->table.find(key);
+    }
+
+    void calendar_server::preload(std::span<const calendar_identifier> keys) const
+    {
+        const auto ptrs = keys 
+            | std::views::transform([](const calendar_identifier& key) { return &key; }) 
+            | std::ranges::to<std::vector>();
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        impl_->load(ptrs, true);
+    }
+
+    void calendar_server::reload(any_calendar_source src) const
+    {
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        impl_->reload(std::move(src), std::nullopt);
+    }
+
+    void calendar_server::reload(any_calendar_source src, std::span<const std::string> updated_codes) const
+    {
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        impl_->reload(std::move(src), updated_codes);
+    }
+
+    std::uint64_t calendar_server::version() const noexcept
+    {
+        return impl_->snapshot.load(std::memory_order_acquire)->version;
     }
 
-} // namespace egret::chrono
\ No newline at end of file
+} // namespace egret::chrono
@@ -1,4 +1,6 @@
+#include <format>
 #include <fstream>
+#include <map>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include "core/assertions/assertion.h"
@@ -9,30 +11,33 @@
 namespace egret::chrono {
     namespace {
         struct _json_file_info {
-            std::filesystem::path path;
             std::filesystem::file_time_type timestamp;
-            nlohmann::json data;
+            std::chrono::steady_clock::time_point checked_at;
+            bool exists;
+            std::vector<std::chrono::sys_days> additional_holidays;
+            std::vector<std::chrono::sys_days> additional_businessdays;
         };
 
-        std::optional<std::vector<std::chrono::sys_days>> _get_days(
-            const std::filesystem::path& dirpath,
+        // parse the file only to extract days. json data is not kept.
+        _json_file_info _load(
+            const std::filesystem::path& path, 
             std::string_view code,
-            std::string_view ext,
-            std::string_view property_name,
-            std::optional<_json_file_info>& cache_json
+            std::filesystem::file_time_type timestamp,
+            std::chrono::steady_clock::time_point now
         )
         {
-            auto path = dirpath / std::format("{}{}", code, ext);
-            auto timestamp = std::filesystem::last_write_time(path);
-            if (cache_json.has_value() && path == cache_json->path && timestamp == cache_json->timestamp) {
-                return impl::get_days(cache_json->data, property_name, code);
-            }
             std::ifstream ifs {path.c_str()};
             if (!ifs.is_open()) {
-                return std::nullopt;
+                return {.timestamp = timestamp, .checked_at = now, .exists = false};
             }
-            cache_json.emplace(std::move(path), std::move(timestamp), nlohmann::json::parse(ifs));
-            return impl::get_days(cache_json->data, property_name, code);
+            const auto json = nlohmann::json::parse(ifs);
+            return {
+                .timestamp = timestamp,
+                .checked_at = now,
+                .exists = true,
+                .additional_holidays = impl::get_days(json, "additional_holidays", code),
+                .additional_businessdays = impl::get_days(json, "additional_businessdays", code),
+            };
         }
 
     } // namespace 
@@ -42,11 +47,49 @@ namespace egret::chrono {
 // -----------------------------------------------------------------------------
     struct json_directory_calendar_source::cache {
         std::mutex mutex;
-        std::optional<_json_file_info> json;
+        std::map<std::string, _json_file_info, std::less<>> files;
+
+        const _json_file_info& get(
+            const std::filesystem::path& dirpath,
+            std::string_view code,
+            std::string_view ext,
+            const std::optional<std::chrono::seconds>& check_interval
+        )
+        {
+            const auto now = std::chrono::steady_clock::now();
+            auto it = files.find(code);
+            if (it != files.end() && (!check_interval || now - it->second.checked_at < *check_interval)) [[likely]] {
+                return it->second;
+            }
+
+            const auto path = dirpath / std::format("{}{}", code, ext);
+            auto ec = std::error_code();
+            const auto timestamp = std::filesystem::last_write_time(path, ec);
+            if (it != files.end() && !ec && it->second.exists && timestamp == it->second.timestamp) {
+                it->second.checked_at = now;
+                return it->second;
+            }
+
+            auto info = ec 
+                ? _json_file_info {.checked_at = now, .exists = false} 
+                : _load(path, code, timestamp, now);
+            if (it != files.end()) {
+                it->second = std::move(info);
+                return it->second;
+            }
+            return files.emplace(std::string(code), std::move(info)).first->second;
+        }
     };
 
-    json_directory_calendar_source::json_directory_calendar_source(std::filesystem::path directory_path, std::string ext) noexcept
-        : dirpath_(std::move(directory_path)), ext_(std::move(ext)), cache_(std::make_shared<cache>())
+    json_directory_calendar_source::json_directory_calendar_source(
+        std::filesystem::path directory_path, 
+        std::string ext,
+        std::optional<std::chrono::seconds> check_interval
+    ) noexcept
+        : dirpath_(std::move(directory_path)), 
+          ext_(std::move(ext)), 
+          check_interval_(std::move(check_interval)), 
+          cache_(std::make_shared<cache>())
     {
     }
 
@@ -59,13 +102,15 @@ namespace egret::chrono {
         -> std::optional<std::vector<std::chrono::sys_days>>
     {
         std::lock_guard<std::mutex> _ {cache_->mutex};
-        return _get_days(dirpath_, code, ext_, "additional_holidays", cache_->json);
+        const auto& info = cache_->get(dirpath_, code, ext_, check_interval_);
+        return info.exists ? std::make_optional(info.additional_holidays) : std::nullopt;
     }
     auto json_directory_calendar_source::get_additional_businessdays(std::string_view code) const
         -> std::optional<std::vector<std::chrono::sys_days>>
     {
         std::lock_guard<std::mutex> _ {cache_->mutex};
-        return _get_days(dirpath_, code, ext_, "additional_businessdays", cache_->json);
+        const auto& info = cache_->get(dirpath_, code, ext_, check_interval_);
+        return info.exists ? std::make_optional(info.additional_businessdays) : std::nullopt;
     }
 
 } // namespace egret::chrono
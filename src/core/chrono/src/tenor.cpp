@@ -1,6 +1,9 @@
 #include <regex>
+#include <vector>
+#include "core/assertions/assertion.h"
 #include "core/assertions/exception.h"
 #include "core/utils/string_utils/trim.h"
+#include "../civil.h"
 #include "../tenor.h"
 
 namespace egret::chrono {
@@ -59,9 +62,9 @@ namespace egret::chrono {
         case tenor_unit::weeks:
             return lhs + std::chrono::days(tnr.count() * 7);
         case tenor_unit::months:
-            return std::chrono::year_month_day(lhs) + std::chrono::months(tnr.count());
+            return chrono::add_months(lhs, tnr.count());
         case tenor_unit::years:
-            return std::chrono::year_month_day(lhs) + std::chrono::years(tnr.count());            
+            return chrono::add_months(lhs, tnr.count() * 12);            
         default:
             throw exception("Unexpected tenor unit");
         }
@@ -84,4 +87,50 @@ namespace egret::chrono {
         return lhs + (-tnr);
     }
 
+// -----------------------------------------------------------------------------
+//  [fn] add_tenors
+// -----------------------------------------------------------------------------
+    void add_tenors(
+        std::span<const std::chrono::sys_days> refs,
+        std::span<const tenor> tenors,
+        std::span<std::chrono::sys_days> result
+    )
+    {
+        const auto n = tenors.size();
+        assertion(
+            refs.size() * n <= result.size(),
+            "Result is too short. [refs.size={}, tenors.size={}, result.size={}]", refs.size(), n, result.size()
+        );
+
+        // tenor as (months, days). exactly one of them is used.
+        struct shift_t {
+            std::int32_t months;
+            std::int32_t days;
+        };
+        auto shifts = std::vector<shift_t>(n);
+        for (std::size_t j = 0; j != n; ++j) {
+            const auto& tnr = tenors[j];
+            switch (tnr.unit()) {
+            case tenor_unit::days:   shifts[j] = {0, tnr.count()}; break;
+            case tenor_unit::weeks:  shifts[j] = {0, tnr.count() * 7}; break;
+            case tenor_unit::months: shifts[j] = {tnr.count(), 0}; break;
+            case tenor_unit::years:  shifts[j] = {tnr.count() * 12, 0}; break;
+            default:
+                throw exception("Unexpected tenor unit");
+            }
+        }
+
+        for (std::size_t i = 0; i != refs.size(); ++i) {
+            const auto& ref = refs[i];
+            const auto c = chrono::to_civil(ref);
+            auto* row = result.data() + i * n;
+            for (std::size_t j = 0; j != n; ++j) {
+                const auto& shift = shifts[j];
+                row[j] = shift.months != 0
+                    ? chrono::from_civil(chrono::add_months(c, shift.months))
+                    : ref + std::chrono::days(shift.days);
+            }
+        }
+    }
+
 } // namespace egret::chrono
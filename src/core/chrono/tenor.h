@@ -4,6 +4,8 @@
 #include <array>
 #include <cstdint>
 #include <chrono>
+#include <compare>
+#include <span>
 #include <string>
 #include <string_view>
 #include <format>
@@ -74,6 +76,11 @@ namespace egret::chrono {
         friend std::chrono::sys_seconds operator +(const std::chrono::sys_seconds& lhs, const tenor& tnr);
         friend std::chrono::sys_seconds operator -(const std::chrono::sys_seconds& lhs, const tenor& tnr);
 
+    // -------------------------------------------------------------------------
+    //  compare
+    //
+        constexpr auto operator<=>(const this_type&) const noexcept = default;
+
     // -------------------------------------------------------------------------
     //  parse
     //
@@ -91,6 +98,19 @@ namespace egret::chrono {
 
     }; // class tenor
 
+// -----------------------------------------------------------------------------
+//  [fn] add_tenors
+// -----------------------------------------------------------------------------
+    /**
+     * @brief result[i * tenors.size() + j] = refs[i] + tenors[j].
+     * @details the year/month decomposition of each reference date is done once for all tenors.
+    */
+    void add_tenors(
+        std::span<const std::chrono::sys_days> refs,
+        std::span<const tenor> tenors,
+        std::span<std::chrono::sys_days> result
+    );
+
 } // namespace egret::chrono
 
 namespace egret::tenor_literals {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 namespace egret::config {
 // -----------------------------------------------------------------------------
 //  [value] is_debug_mode
@@ -17,4 +19,13 @@ namespace egret::config {
 // -----------------------------------------------------------------------------
     inline constexpr bool disable_date_json_conversion = false;
 
+// -----------------------------------------------------------------------------
+//  [value] calendar_bitmap_horizon
+// -----------------------------------------------------------------------------
+#if defined(EGRET_CALENDAR_BITMAP_HORIZON_YEARS)
+    inline constexpr auto calendar_bitmap_horizon = std::chrono::years(EGRET_CALENDAR_BITMAP_HORIZON_YEARS);
+#else
+    inline constexpr auto calendar_bitmap_horizon = std::chrono::years(50);
+#endif
+
 } // namespace egret::config
@@ -31,7 +31,7 @@ namespace egret::cpt {
 // -----------------------------------------------------------------------------
     template <typename T>
     concept additive_group =
-        std::is_convertible_v<std::remove_cvref_t<T>, int> &&
+        std::is_convertible_v<int, std::remove_cvref_t<T>> &&
         requires (const T& x, const T& y) {
             { - x } -> std::convertible_to<std::remove_cvref_t<T>>;
             {x - y} -> std::convertible_to<std::remove_cvref_t<T>>;
@@ -0,0 +1,3 @@
+#pragma once
+
+#include "core/math/autodiff/dual.h"
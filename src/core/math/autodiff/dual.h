@@ -0,0 +1,273 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "core/assertions/assertion.h"
+
+namespace egret::math::autodiff {
+// -----------------------------------------------------------------------------
+//  [class] dual
+// -----------------------------------------------------------------------------
+    /**
+     * @brief scalar of forward mode automatic differentiation.
+     * @details
+     *  holds a value and its gradient with respect to N independent variables.
+     *  N = std::dynamic_extent stores the gradient in std::vector, whose empty state stands for a constant,
+     *  so constants converted from T do not allocate.
+     *  dual<T, N> satisfies cpt::strict_vector<dual<T, N>, T>, and can be used as values of interpolants and curves.
+    */
+    template <std::floating_point T, std::size_t N = std::dynamic_extent>
+    class dual {
+    private:
+        using this_type = dual;
+        static constexpr bool is_dynamic = N == std::dynamic_extent;
+
+    public:
+        using value_type = T;
+        using gradient_type = std::conditional_t<is_dynamic, std::vector<T>, std::array<T, N>>;
+
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        constexpr dual() noexcept : dual(T(0)) {}
+        constexpr dual(const this_type&) = default;
+        constexpr dual(this_type&&) noexcept = default;
+
+        constexpr dual(T value) noexcept
+            : value_(value), gradient_()
+        {
+        }
+
+        constexpr dual(T value, gradient_type gradient) noexcept(!is_dynamic)
+            : value_(value), gradient_(std::move(gradient))
+        {
+        }
+
+        constexpr this_type& operator =(const this_type&) = default;
+        constexpr this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  factories
+    //
+        /**
+         * @brief the i-th independent variable of n variables.
+        */
+        static constexpr this_type variable(T value, std::size_t i, std::size_t n = is_dynamic ? 0 : N)
+        {
+            egret::assertion(i < n, "Variable index is out of range. [index={}, size={}]", i, n);
+            auto result = this_type(value);
+            if constexpr (is_dynamic) {
+                result.gradient_.assign(n, T(0));
+            }
+            else {
+                egret::assertion(n == N, "Number of variables must agree with the size of gradient. [expected={}, actual={}]", N, n);
+            }
+            result.gradient_[i] = T(1);
+            return result;
+        }
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        constexpr const T& value() const noexcept { return value_; }
+        constexpr const gradient_type& gradient() const noexcept { return gradient_; }
+        constexpr std::size_t size() const noexcept { return gradient_.size(); }
+
+        /**
+         * @brief derivative with respect to the i-th variable. zero for constants.
+        */
+        constexpr T derivative(std::size_t i) const noexcept
+        {
+            return i < gradient_.size() ? gradient_[i] : T(0);
+        }
+
+    // -------------------------------------------------------------------------
+    //  arithmetic
+    //
+        constexpr this_type operator +() const { return *this; }
+        constexpr this_type operator -() const
+        {
+            auto result = *this;
+            result.value_ = -result.value_;
+            for (auto& g : result.gradient_) {
+                g = -g;
+            }
+            return result;
+        }
+
+        constexpr this_type& operator +=(const this_type& other)
+        {
+            this->axpy(T(1), other);
+            value_ += other.value_;
+            return *this;
+        }
+        constexpr this_type& operator -=(const this_type& other)
+        {
+            this->axpy(T(-1), other);
+            value_ -= other.value_;
+            return *this;
+        }
+        constexpr this_type& operator *=(const this_type& other)
+        {
+            if (this == &other) {
+                // d(uu) = 2u du
+                this->scale(T(2) * value_);
+                value_ *= value_;
+                return *this;
+            }
+            // d(uv) = v du + u dv
+            this->scale(other.value_);
+            this->axpy(value_, other);
+            value_ *= other.value_;
+            return *this;
+        }
+        constexpr this_type& operator /=(const this_type& other)
+        {
+            if (this == &other) {
+                *this = this_type(T(1));
+                return *this;
+            }
+            // d(u/v) = (du - (u/v) dv) / v
+            const T inv = T(1) / other.value_;
+            value_ *= inv;
+            this->axpy(-value_, other);
+            this->scale(inv);
+            return *this;
+        }
+
+        constexpr this_type& operator +=(T c) noexcept { value_ += c; return *this; }
+        constexpr this_type& operator -=(T c) noexcept { value_ -= c; return *this; }
+        constexpr this_type& operator *=(T c) noexcept { value_ *= c; this->scale(c); return *this; }
+        constexpr this_type& operator /=(T c) noexcept { return *this *= (T(1) / c); }
+
+        friend constexpr this_type operator +(this_type x, const this_type& y) { x += y; return x; }
+        friend constexpr this_type operator -(this_type x, const this_type& y) { x -= y; return x; }
+        friend constexpr this_type operator *(this_type x, const this_type& y) { x *= y; return x; }
+        friend constexpr this_type operator /(this_type x, const this_type& y) { x /= y; return x; }
+
+        friend constexpr this_type operator +(this_type x, T c) { x += c; return x; }
+        friend constexpr this_type operator -(this_type x, T c) { x -= c; return x; }
+        friend constexpr this_type operator *(this_type x, T c) { x *= c; return x; }
+        friend constexpr this_type operator /(this_type x, T c) { x /= c; return x; }
+
+        friend constexpr this_type operator +(T c, this_type x) { x += c; return x; }
+        friend constexpr this_type operator -(T c, const this_type& x) { auto result = -x; result += c; return result; }
+        friend constexpr this_type operator *(T c, this_type x) { x *= c; return x; }
+        friend constexpr this_type operator /(T c, const this_type& x) { auto result = this_type(c); result /= x; return result; }
+
+    // -------------------------------------------------------------------------
+    //  comparison
+    //
+        /**
+         * @brief compares values only, so that branches in interpolants follow the primal computation.
+        */
+        friend constexpr bool operator ==(const this_type& x, const this_type& y) noexcept { return x.value_ == y.value_; }
+        friend constexpr bool operator ==(const this_type& x, T c) noexcept { return x.value_ == c; }
+        friend constexpr auto operator <=>(const this_type& x, const this_type& y) noexcept { return x.value_ <=> y.value_; }
+        friend constexpr auto operator <=>(const this_type& x, T c) noexcept { return x.value_ <=> c; }
+
+    // -------------------------------------------------------------------------
+    //  elementary functions
+    //
+        friend this_type exp(this_type x)
+        {
+            x.value_ = std::exp(x.value_);
+            x.scale(x.value_);
+            return x;
+        }
+        friend this_type log(this_type x)
+        {
+            x.chain(T(1) / x.value_);
+            x.value_ = std::log(x.value_);
+            return x;
+        }
+        friend this_type sqrt(this_type x)
+        {
+            x.value_ = std::sqrt(x.value_);
+            x.chain(T(0.5) / x.value_);
+            return x;
+        }
+        friend this_type pow(this_type x, T p)
+        {
+            // d(u^p) = p u^(p - 1) du, where u^p / u is undefined at u = 0
+            const T v = std::pow(x.value_, p);
+            const T d = p == T(0) ? T(0)
+                : x.value_ != T(0) ? p * v / x.value_
+                : p * std::pow(x.value_, p - T(1));
+            x.chain(d);
+            x.value_ = v;
+            return x;
+        }
+        friend this_type abs(this_type x)
+        {
+            return x.value_ < T(0) ? -std::move(x) : std::move(x);
+        }
+
+    private:
+        constexpr void scale(T c) noexcept
+        {
+            for (auto& g : gradient_) {
+                g *= c;
+            }
+        }
+
+        // chain rule by the derivative d of an elementary function. zero entries are kept as is, 
+        // so that variables x does not depend on do not turn into nan when d is infinite at a boundary such as sqrt(0).
+        constexpr void chain(T d) noexcept
+        {
+            for (auto& g : gradient_) {
+                if (g != T(0)) {
+                    g *= d;
+                }
+            }
+        }
+
+        // gradient += a * other.gradient
+        constexpr void axpy(T a, const this_type& other)
+        {
+            if constexpr (is_dynamic) {
+                if (other.gradient_.empty()) {
+                    return;
+                }
+                if (gradient_.empty()) {
+                    gradient_.assign(other.gradient_.size(), T(0));
+                }
+                egret::assertion(
+                    gradient_.size() == other.gradient_.size(),
+                    "Sizes of gradients are different. [lhs={}, rhs={}]", gradient_.size(), other.gradient_.size()
+                );
+            }
+            for (std::size_t i = 0; i != gradient_.size(); ++i) {
+                gradient_[i] += a * other.gradient_[i];
+            }
+        }
+
+    private:
+        T value_;
+        gradient_type gradient_;
+
+    }; // class dual
+
+// -----------------------------------------------------------------------------
+//  [fn] variables
+// -----------------------------------------------------------------------------
+    /**
+     * @brief seeds values as independent variables. the i-th result has the unit gradient for the i-th variable.
+    */
+    template <std::floating_point T>
+    std::vector<dual<T>> variables(std::span<const T> values)
+    {
+        auto result = std::vector<dual<T>> {};
+        result.reserve(values.size());
+        for (std::size_t i = 0; i != values.size(); ++i) {
+            result.push_back(dual<T>::variable(values[i], i, values.size()));
+        }
+        return result;
+    }
+
+} // namespace egret::math::autodiff
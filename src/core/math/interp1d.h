@@ -7,6 +7,8 @@
 #include "core/math/interp1d/linear.h"
 #include "core/math/interp1d/pwconst.h"
 #include "core/math/interp1d/cspline.h"
+#include "core/math/interp1d/cursor.h"
+#include "core/math/interp1d/uniform_grids.h"
 
 #include "core/math/interp1d/slopes/concepts.h"
 #include "core/math/interp1d/slopes/any_slope_generator.h"
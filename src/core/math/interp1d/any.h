@@ -15,6 +15,7 @@
 #include "core/math/der.h"
 #include "core/math/integrate.h"
 #include "concepts.h"
+#include "cursor.h"
 
 namespace egret::math::interp1d {
 // -----------------------------------------------------------------------------
@@ -36,12 +37,15 @@ namespace egret::math::interp1d {
         struct base {
             virtual ~base() = default;
             virtual Y call(const X& x) const = 0;
+            virtual Y call(const X& x, interval_hint& hint) const = 0;
             virtual const std::vector<X>& grids() const noexcept = 0;
             virtual const std::vector<Y>& values() const noexcept = 0;
             virtual std::type_index type() const noexcept = 0;
             virtual const void* ptr() const noexcept = 0;
             virtual std::optional<Y> der1(const X& arg) const = 0;
             virtual std::optional<Y> der2(const X& arg) const = 0;
+            virtual std::optional<Y> der1(const X& arg, interval_hint& hint) const = 0;
+            virtual std::optional<Y> der2(const X& arg, interval_hint& hint) const = 0;
             virtual std::optional<Y> integrate(const X& from, const X& to) const = 0;
             virtual const extra_abilities& abilities() const noexcept = 0;
         };
@@ -79,6 +83,15 @@ namespace egret::math::interp1d {
                 values_provider_.assign_if_non_member(interp1d::values(obj_));
             }
             Y call(const X& x) const override { return obj_(x); }
+            Y call(const X& x, interval_hint& hint) const override
+            {
+                if constexpr (requires { {obj_(x, hint)} -> std::convertible_to<Y>; }) {
+                    return obj_(x, hint);
+                }
+                else {
+                    return obj_(x);
+                }
+            }
             const std::vector<X>& grids() const noexcept override { return grids_provider_.get(obj_); }
             const std::vector<Y>& values() const noexcept override { return values_provider_.get(obj_);}
             std::type_index type() const noexcept override { return typeid(C); }
@@ -101,6 +114,24 @@ namespace egret::math::interp1d {
                     return std::nullopt;
                 }
             }
+            std::optional<Y> der1(const X& arg, interval_hint& hint) const override
+            {
+                if constexpr (requires { {obj_.der1(arg, hint)} -> std::convertible_to<Y>; }) {
+                    return obj_.der1(arg, hint);
+                }
+                else {
+                    return this->der1(arg);
+                }
+            }
+            std::optional<Y> der2(const X& arg, interval_hint& hint) const override
+            {
+                if constexpr (requires { {obj_.der2(arg, hint)} -> std::convertible_to<Y>; }) {
+                    return obj_.der2(arg, hint);
+                }
+                else {
+                    return this->der2(arg);
+                }
+            }
             std::optional<Y> integrate(const X& from, const X& to) const override
             {
                 if constexpr (cpt::integrable_r<C, Y, X>) {
@@ -150,6 +181,7 @@ namespace egret::math::interp1d {
     //  interpolation behavior
     //
         Y operator()(const X& x) const { return obj_->call(x); }
+        Y operator()(const X& x, interval_hint& hint) const { return obj_->call(x, hint); }
         const std::vector<X>& grids() const noexcept { return obj_->grids(); }
         const std::vector<Y>& values() const noexcept { return obj_->values(); }
 
@@ -172,6 +204,18 @@ namespace egret::math::interp1d {
             return result ? *std::move(result) : throw exception("Internal object does not supprot der2.").record_stacktrace();
         }
 
+        Y der1(const X& x, interval_hint& hint) const
+        {
+            auto result = obj_->der1(x, hint);
+            return result ? *std::move(result) : throw exception("Internal object does not supprot der1.").record_stacktrace();
+        }
+
+        Y der2(const X& x, interval_hint& hint) const
+        {
+            auto result = obj_->der2(x, hint);
+            return result ? *std::move(result) : throw exception("Internal object does not supprot der2.").record_stacktrace();
+        }
+
         Y integrate(const X& from, const X& to) const
         {
             auto result = obj_->integrate(from, to);
@@ -226,12 +270,15 @@ namespace egret::math::interp1d {
             mutable_concrete(C obj) : obj_(std::move(obj)) {}
 
             value_type call(const grid_type& x) const override { return obj_.call(x); }
+            value_type call(const grid_type& x, interval_hint& hint) const override { return obj_.call(x, hint); }
             const std::vector<grid_type>& grids() const noexcept override { return obj_.grids(); }
             const std::vector<value_type>& values() const noexcept override { return obj_.values();}
             std::type_index type() const noexcept override { return obj_.type(); }
             const void* ptr() const noexcept override { return obj_.ptr(); }
             std::optional<value_type> der1(const grid_type& arg) const override { return obj_.der1(arg); }
             std::optional<value_type> der2(const grid_type& arg) const override { return obj_.der2(arg); }
+            std::optional<value_type> der1(const grid_type& arg, interval_hint& hint) const override { return obj_.der1(arg, hint); }
+            std::optional<value_type> der2(const grid_type& arg, interval_hint& hint) const override { return obj_.der2(arg, hint); }
             std::optional<value_type> integrate(const grid_type& from, const grid_type& to) const override { return obj_.integrate(from, to); }
             const typename super_type::extra_abilities& abilities() const noexcept override { return obj_.abilities(); }
 
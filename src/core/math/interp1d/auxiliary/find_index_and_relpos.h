@@ -2,6 +2,7 @@
 
 #include "core/utils/range_utils/find_interval.h"
 #include "../concepts.h"
+#include "../cursor.h"
 #include "relpos.h"
 
 namespace egret_detail::interp1d_impl {
@@ -37,5 +38,19 @@ namespace egret_detail::interp1d_impl {
         const auto idx = std::ranges::distance(std::ranges::begin(xs), xlit);
         return { idx, static_cast<RelposType>(relpos(x).between(*xlit, *xrit)) };
     }
+
+    template <
+        std::ranges::random_access_range Xs, 
+        egret::math::interp1d::relpos_computable_from<std::ranges::range_reference_t<Xs>> X,
+        std::strict_weak_order<std::ranges::range_reference_t<Xs>, const X> Less
+    >
+    constexpr auto find_index_and_relpos_near(Xs&& xs, const X& x, egret::math::interp1d::interval_hint& hint, const Less& less)
+        -> std::pair<std::ranges::range_difference_t<Xs>, egret::math::interp1d::relpos_t<X, std::ranges::range_reference_t<Xs>>>
+    {
+        const auto [xlit, xrit] = egret::util::find_interval_near(xs, x, hint.index, less);
+        const auto idx = std::ranges::distance(std::ranges::begin(xs), xlit);
+        hint.index = idx;
+        return { idx, relpos(x).between(*xlit, *xrit) };
+    }
     
 } // namespace egret_detail::interp1d_impl
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <ranges>
+#include <functional>
+#include "core/assertions/exception.h"
+#include "core/utils/range_utils/find_interval.h"
+
+namespace egret_detail::interp1d_impl {
+// -----------------------------------------------------------------------------
+//  [fn] for_each_sorted_interval
+// -----------------------------------------------------------------------------
+    /**
+     * @brief calls f(query, index) with the index of the interval of grids for each query.
+     * @details
+     *  the index agrees with util::find_interval. each query is located by util::find_interval_near from the interval
+     *  of the previous one, so ascending queries cost O(1) amortized and long jumps or unsorted queries O(log n).
+    */
+    template <std::ranges::random_access_range Xs, std::ranges::input_range Qs, typename Less, typename F>
+    constexpr void for_each_sorted_interval(const Xs& grids, Qs&& queries, const Less& less, F&& f)
+    {
+        const auto beg = std::ranges::begin(grids);
+        const auto sz = std::ranges::distance(grids);
+        if (sz < 2) {
+            throw egret::exception("Range must have 2 elements at least to use find_interval, but has only {}.", sz).record_stacktrace();
+        }
+        auto idx = std::ranges::range_difference_t<const Xs&>(0);
+        for (auto&& q : queries) {
+            idx = std::ranges::distance(beg, egret::util::find_interval_near(grids, q, idx, less).first);
+            std::invoke(f, q, idx);
+        }
+    }
+
+} // namespace egret_detail::interp1d_impl
@@ -3,6 +3,7 @@
 #include <vector>
 #include <nlohmann/json_fwd.hpp>
 #include "concepts.h"
+#include "uniform_grids.h"
 #include "core/math/algebra/concepts.h"
 #include "core/utils/range_utils/vector_assign.h"
 #include "core/utils/json_utils/j2obj.h"
@@ -11,6 +12,7 @@
 #include "core/assertions/assertion.h"
 #include "slopes/concepts.h"
 #include "auxiliary/find_index_and_relpos.h"
+#include "auxiliary/sorted_intervals.h"
 #include "auxiliary/interpolatee_validation.h"
 #include "auxiliary/integrate_impl.h"
 #include "auxiliary/json_deserializer_impl.h"
@@ -33,12 +35,13 @@ namespace egret::math::interp1d {
             std::ranges::iterator_t<const std::vector<Y>>,
             std::back_insert_iterator<std::vector<Y>>
         >,
-        typename Less = std::ranges::less
+        typename Less = std::ranges::less,
+        cpt::random_access_range_of<X> Grids = std::vector<X>
     >
     class cspline {
     private:
         using this_type = cspline;
-        using spfn_props = special_function_properties<std::vector<X>, std::vector<Y>, SlopeGenerator, Less>;
+        using spfn_props = special_function_properties<Grids, std::vector<Y>, SlopeGenerator, Less>;
 
         static_assert(
             relpos_computable<X>, 
@@ -52,6 +55,9 @@ namespace egret::math::interp1d {
         static_assert(
             cpt::module<std::common_type_t<relpos_t<X>, Y>, relpos_t<X>>, 
             "Relative position type of grids must be a module coefficient of reuslt type.");
+        static_assert(
+            std::same_as<std::ranges::iterator_t<const Grids>, std::ranges::iterator_t<const std::vector<X>>>,
+            "Grids must be iterated as std::vector<X>, which slope generators expect.");
             
     public:
     // -------------------------------------------------------------------------
@@ -65,7 +71,7 @@ namespace egret::math::interp1d {
             requires spfn_props::are_move_constructible_v = default;
 
         template <
-            cpt::constructible_to<std::vector<X>> AXs, 
+            cpt::constructible_to<Grids> AXs, 
             cpt::constructible_to<std::vector<Y>> AYs,
             cpt::constructible_to<SlopeGenerator> SG,
             cpt::constructible_to<Less> ALess
@@ -83,7 +89,7 @@ namespace egret::math::interp1d {
         }
 
         template <
-            cpt::constructible_to<std::vector<X>> AXs, 
+            cpt::constructible_to<Grids> AXs, 
             cpt::constructible_to<std::vector<Y>> AYs,
             cpt::constructible_to<SlopeGenerator> SG
         >
@@ -102,7 +108,7 @@ namespace egret::math::interp1d {
     // -------------------------------------------------------------------------
     //  interpolatotion1d behavior
     //
-        const std::vector<X>& grids() const noexcept { return grids_; }
+        const Grids& grids() const noexcept { return grids_; }
         const std::vector<Y>& values() const noexcept { return values_; }
 
         template <relpos_computable_from<X> AX>
@@ -122,6 +128,26 @@ namespace egret::math::interp1d {
             );
         }
 
+        /**
+         * @brief evaluates searching from the interval of hint, and updates hint with the found interval.
+        */
+        template <relpos_computable_from<X> AX>
+            requires 
+                std::strict_weak_order<const Less&, const X&, const AX&> &&
+                std::common_with<relpos_t<AX, X>, Y> &&
+                cpt::module<std::common_type_t<relpos_t<AX, X>, Y>, relpos_t<AX, X>>
+        auto operator()(const AX& x, interval_hint& hint) const
+            -> std::common_type_t<relpos_t<AX, X>, Y>
+        {
+            const auto [idx, w] = egret_detail::interp1d_impl::find_index_and_relpos_near(grids_, x, hint, less_);
+            return static_cast<std::common_type_t<relpos_t<AX, X>, Y>>(
+                coefficients_[4 * idx]
+                + coefficients_[4 * idx + 1] * w
+                + coefficients_[4 * idx + 2] * (w * w / 2)
+                + coefficients_[4 * idx + 3] * (w * w * w / 6)
+            );
+        }
+
     // -------------------------------------------------------------------------
     //  mutable behavior
     //
@@ -129,7 +155,12 @@ namespace egret::math::interp1d {
         void initialize(Xs&& xs, Ys&& ys)
         {
             egret_detail::interp1d_impl::interpolatee_validation(xs, ys, less_);
-            util::vector_assign(grids_, std::forward<Xs>(xs));
+            if constexpr (std::same_as<Grids, std::vector<X>>) {
+                util::vector_assign(grids_, std::forward<Xs>(xs));
+            }
+            else {
+                grids_ = Grids(std::forward<Xs>(xs));
+            }
             util::vector_assign(values_, std::forward<Ys>(ys));
             this->_calculate_coefficients();
         }
@@ -151,7 +182,7 @@ namespace egret::math::interp1d {
                 std::strict_weak_order<const Less&, const X&, const AX&> &&
                 std::common_with<relpos_t<AX, X>, Y> &&
                 cpt::module<std::common_type_t<relpos_t<AX, X>, Y>, relpos_t<AX, X>>
-        auto der1(const X& x) const
+        auto der1(const AX& x) const
             -> std::common_type_t<relpos_t<AX, X>, Y>
         {
             const auto [xlit, xrit] = util::find_interval(grids_, x, less_);
@@ -172,7 +203,29 @@ namespace egret::math::interp1d {
                 std::strict_weak_order<const Less&, const X&, const AX&> &&
                 std::common_with<relpos_t<AX, X>, Y> &&
                 cpt::module<std::common_type_t<relpos_t<AX, X>, Y>, relpos_t<AX, X>>
-        auto der2(const X& x) const
+        auto der1(const AX& x, interval_hint& hint) const
+            -> std::common_type_t<relpos_t<AX, X>, Y>
+        {
+            const auto [xlit, xrit] = util::find_interval_near(grids_, x, hint.index, less_);
+            const auto idx = static_cast<std::size_t>(xlit - grids_.begin());
+            hint.index = static_cast<std::ptrdiff_t>(idx);
+            const auto xdist = interp1d::distance(*xlit, *xrit);
+            const auto w = interp1d::distance(*xlit, x) / xdist;
+            return static_cast<std::common_type_t<relpos_t<AX, X>, Y>>(
+                (
+                    coefficients_[4 * idx + 1]
+                    + coefficients_[4 * idx + 2] * w
+                    + coefficients_[4 * idx + 3] * (w * w / 2)
+                ) / xdist
+            );
+        }
+
+        template <relpos_computable_from<X> AX>
+            requires 
+                std::strict_weak_order<const Less&, const X&, const AX&> &&
+                std::common_with<relpos_t<AX, X>, Y> &&
+                cpt::module<std::common_type_t<relpos_t<AX, X>, Y>, relpos_t<AX, X>>
+        auto der2(const AX& x) const
             -> std::common_type_t<relpos_t<AX, X>, Y>
         {
             const auto [xlit, xrit] = util::find_interval(grids_, x, less_);
@@ -187,6 +240,83 @@ namespace egret::math::interp1d {
             );
         }
 
+        template <relpos_computable_from<X> AX>
+            requires 
+                std::strict_weak_order<const Less&, const X&, const AX&> &&
+                std::common_with<relpos_t<AX, X>, Y> &&
+                cpt::module<std::common_type_t<relpos_t<AX, X>, Y>, relpos_t<AX, X>>
+        auto der2(const AX& x, interval_hint& hint) const
+            -> std::common_type_t<relpos_t<AX, X>, Y>
+        {
+            const auto [xlit, xrit] = util::find_interval_near(grids_, x, hint.index, less_);
+            const auto idx = static_cast<std::size_t>(xlit - grids_.begin());
+            hint.index = static_cast<std::ptrdiff_t>(idx);
+            const auto xdist = interp1d::distance(*xlit, *xrit);
+            const auto w = interp1d::distance(*xlit, x) / xdist;
+            return static_cast<std::common_type_t<relpos_t<AX, X>, Y>>(
+                (
+                    coefficients_[4 * idx + 2]
+                    + coefficients_[4 * idx + 3] * w
+                ) / (xdist * xdist)
+            );
+        }
+
+    // -------------------------------------------------------------------------
+    //  sorted batch
+    //
+        /**
+         * @brief evaluates at xs and writes results into out. xs in ascending order are located in O(1) amortized each.
+        */
+        template <std::ranges::input_range Qs, typename O>
+            requires
+                std::invocable<const this_type&, const std::ranges::range_value_t<Qs>&> &&
+                std::output_iterator<O, std::invoke_result_t<const this_type&, const std::ranges::range_value_t<Qs>&>>
+        O evaluate_sorted(Qs&& xs, O out) const
+        {
+            using result_t = std::invoke_result_t<const this_type&, const std::ranges::range_value_t<Qs>&>;
+            egret_detail::interp1d_impl::for_each_sorted_interval(grids_, xs, less_, [&](const auto& x, auto idx) {
+                const auto w = egret_detail::interp1d_impl::relpos(x).between(grids_[idx], grids_[idx + 1]);
+                const auto* c = coefficients_.data() + 4 * idx;
+                *out = static_cast<result_t>(c[0] + c[1] * w + c[2] * (w * w / 2) + c[3] * (w * w * w / 6));
+                ++out;
+            });
+            return out;
+        }
+
+        template <std::ranges::input_range Qs, typename O>
+            requires
+                requires (const this_type& f, const std::ranges::range_value_t<Qs>& x) { f.der1(x); } &&
+                std::output_iterator<O, decltype(std::declval<const this_type&>().der1(std::declval<const std::ranges::range_value_t<Qs>&>()))>
+        O der1_sorted(Qs&& xs, O out) const
+        {
+            using result_t = decltype(this->der1(std::declval<const std::ranges::range_value_t<Qs>&>()));
+            egret_detail::interp1d_impl::for_each_sorted_interval(grids_, xs, less_, [&](const auto& x, auto idx) {
+                const auto xdist = interp1d::distance(grids_[idx], grids_[idx + 1]);
+                const auto w = interp1d::distance(grids_[idx], x) / xdist;
+                const auto* c = coefficients_.data() + 4 * idx;
+                *out = static_cast<result_t>((c[1] + c[2] * w + c[3] * (w * w / 2)) / xdist);
+                ++out;
+            });
+            return out;
+        }
+
+        template <std::ranges::input_range Qs, typename O>
+            requires
+                requires (const this_type& f, const std::ranges::range_value_t<Qs>& x) { f.der2(x); } &&
+                std::output_iterator<O, decltype(std::declval<const this_type&>().der2(std::declval<const std::ranges::range_value_t<Qs>&>()))>
+        O der2_sorted(Qs&& xs, O out) const
+        {
+            using result_t = decltype(this->der2(std::declval<const std::ranges::range_value_t<Qs>&>()));
+            egret_detail::interp1d_impl::for_each_sorted_interval(grids_, xs, less_, [&](const auto& x, auto idx) {
+                const auto xdist = interp1d::distance(grids_[idx], grids_[idx + 1]);
+                const auto w = interp1d::distance(grids_[idx], x) / xdist;
+                const auto* c = coefficients_.data() + 4 * idx;
+                *out = static_cast<result_t>((c[2] + c[3] * w) / (xdist * xdist));
+                ++out;
+            });
+            return out;
+        }
+
     // -------------------------------------------------------------------------
     //  integrate
     //
@@ -285,7 +415,7 @@ namespace egret::math::interp1d {
         const Less& less() const noexcept { return less_; }
 
     private:
-        std::vector<X> grids_;
+        Grids grids_;
         std::vector<Y> values_;
         SlopeGenerator slope_generator_;
         Less less_;
@@ -331,13 +461,39 @@ namespace egret::math::interp1d {
     template <std::ranges::forward_range Xs, std::ranges::forward_range Ys, typename SG, typename Less>
     cspline(Xs, Ys, SG, Less)
         -> cspline<std::ranges::range_value_t<Xs>, std::ranges::range_value_t<Ys>, SG, Less>;
+
+    template <typename X, std::ranges::forward_range Ys, typename SG>
+    cspline(uniform_grids<X>, Ys, SG)
+        -> cspline<X, std::ranges::range_value_t<Ys>, SG, std::ranges::less, uniform_grids<X>>;
+
+    template <typename X, std::ranges::forward_range Ys, typename SG, typename Less>
+    cspline(uniform_grids<X>, Ys, SG, Less)
+        -> cspline<X, std::ranges::range_value_t<Ys>, SG, Less, uniform_grids<X>>;
+
+// -----------------------------------------------------------------------------
+//  [type] uniform_cspline
+// -----------------------------------------------------------------------------
+    /**
+     * @brief cspline on equally spaced grids, which locates intervals arithmetically instead of searching.
+    */
+    template <
+        distance_measurable X, distance_measurable Y,
+        typename SlopeGenerator = any_slope_generator<
+            std::ranges::iterator_t<const std::vector<X>>, 
+            std::ranges::sentinel_t<const std::vector<X>>,
+            std::ranges::iterator_t<const std::vector<Y>>,
+            std::back_insert_iterator<std::vector<Y>>
+        >,
+        typename Less = std::ranges::less
+    >
+    using uniform_cspline = cspline<X, Y, SlopeGenerator, Less, uniform_grids<X>>;
         
 } // namespace egret::math::interp1d
 
 namespace nlohmann {
-    template <typename X, typename Y, typename SG, typename Less>
-    struct adl_serializer<egret::math::interp1d::cspline<X, Y, SG, Less>> {
-        using target_type = egret::math::interp1d::cspline<X, Y, SG, Less>;
+    template <typename X, typename Y, typename SG, typename Less, typename Grids>
+    struct adl_serializer<egret::math::interp1d::cspline<X, Y, SG, Less, Grids>> {
+        using target_type = egret::math::interp1d::cspline<X, Y, SG, Less, Grids>;
 
         template <typename Json>
             requires 
@@ -350,7 +506,7 @@ namespace nlohmann {
             namespace impl = egret_detail::interp1d_impl;
             auto [xs, ys] = impl::recover_knots<X, Y>(j);
             auto slope_gen = ("slope_generator" >> egret::util::j2obj::get<SG>)(j);
-            return target_type{std::move(xs), std::move(ys), std::move(slope_gen)};
+            return target_type{Grids(std::move(xs)), std::move(ys), std::move(slope_gen)};
         }
 
         template <typename Json>
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace egret::math::interp1d {
+// -----------------------------------------------------------------------------
+//  [struct] interval_hint
+// -----------------------------------------------------------------------------
+    /**
+     * @brief index of the interval found by the previous evaluation.
+     * @details interpolators accepting a hint start searching from it, and update it with the found interval.
+    */
+    struct interval_hint {
+        std::ptrdiff_t index = 0;
+    };
+
+// -----------------------------------------------------------------------------
+//  [class] cursor
+// -----------------------------------------------------------------------------
+    /**
+     * @brief stateful evaluator of an interpolation which remembers the last interval.
+     * @details
+     *  sequential queries, e.g. daily steps, cost O(1) amortized instead of a binary search for each.
+     *  interpolations without hinted overloads are evaluated as they are.
+     *  the cursor refers to the interpolation, which must outlive it.
+    */
+    template <typename F>
+    class cursor {
+    private:
+        using this_type = cursor;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        cursor() = delete;
+        cursor(const this_type&) = default;
+        cursor(this_type&&) noexcept = default;
+
+        explicit cursor(const F& f) noexcept
+            : f_(std::addressof(f)), hint_()
+        {
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  interpolation behavior
+    //
+        template <typename X>
+            requires requires (const F& f, const X& x) { f(x); }
+        auto operator()(const X& x)
+        {
+            if constexpr (requires (const F& f, interval_hint& hint) { f(x, hint); }) {
+                return (*f_)(x, hint_);
+            }
+            else {
+                return (*f_)(x);
+            }
+        }
+
+        template <typename X>
+            requires requires (const F& f, const X& x) { f.der1(x); }
+        auto der1(const X& x)
+        {
+            if constexpr (requires (const F& f, interval_hint& hint) { f.der1(x, hint); }) {
+                return f_->der1(x, hint_);
+            }
+            else {
+                return f_->der1(x);
+            }
+        }
+
+        template <typename X>
+            requires requires (const F& f, const X& x) { f.der2(x); }
+        auto der2(const X& x)
+        {
+            if constexpr (requires (const F& f, interval_hint& hint) { f.der2(x, hint); }) {
+                return f_->der2(x, hint_);
+            }
+            else {
+                return f_->der2(x);
+            }
+        }
+
+    // -------------------------------------------------------------------------
+    //  state
+    //
+        void reset() noexcept { hint_ = {}; }
+        const interval_hint& hint() const noexcept { return hint_; }
+        const F& function() const noexcept { return *f_; }
+
+    private:
+        const F* f_;
+        interval_hint hint_;
+
+    }; // class cursor
+
+    template <typename F>
+    cursor(const F&) -> cursor<F>;
+
+} // namespace egret::math::interp1d
@@ -11,10 +11,12 @@
 #include "core/math/algebra/concepts.h"
 
 #include "concepts.h"
+#include "uniform_grids.h"
 #include "auxiliary/interpolatee_validation.h"
 #include "auxiliary/find_index_and_relpos.h"
 #include "auxiliary/integrate_impl.h"
 #include "auxiliary/interval_at.h"
+#include "auxiliary/sorted_intervals.h"
 #include "auxiliary/json_deserializer_impl.h"
 
 namespace egret::math::interp1d {
@@ -105,6 +107,83 @@ namespace egret::math::interp1d {
             );
         }
 
+        /**
+         * @brief evaluates searching from the interval of hint, and updates hint with the found interval.
+        */
+        template <relpos_computable_from<grid_type> X>
+            requires 
+                std::ranges::random_access_range<const Xs> &&
+                std::strict_weak_order<const Less&, const grid_type&, const X&> &&
+                std::common_with<relpos_t<X, grid_type>, value_type> &&
+                cpt::module<std::common_type_t<relpos_t<X, grid_type>, value_type>, relpos_t<X, grid_type>>
+        constexpr auto operator()(const X& x, interval_hint& hint) const
+            -> std::common_type_t<relpos_t<X, grid_type>, value_type>
+        {
+            namespace impl = egret_detail::interp1d_impl;
+            const auto [idx, wr] = impl::find_index_and_relpos_near(grids_.get(), x, hint, less_);
+            const auto [ylit, yrit] = impl::interval_at(idx, values_.get());
+            return static_cast<std::common_type_t<relpos_t<X, grid_type>, value_type>>(
+                *ylit * (1 - wr) + *yrit * wr
+            );
+        }
+
+    // -------------------------------------------------------------------------
+    //  sorted batch
+    //
+        /**
+         * @brief evaluates at xs and writes results into out. xs in ascending order are located in O(1) amortized each.
+        */
+        template <std::ranges::input_range Qs, typename O>
+            requires
+                std::ranges::random_access_range<const Xs> &&
+                std::ranges::random_access_range<const Ys> &&
+                std::invocable<const this_type&, const std::ranges::range_value_t<Qs>&> &&
+                std::output_iterator<O, std::invoke_result_t<const this_type&, const std::ranges::range_value_t<Qs>&>>
+        constexpr O evaluate_sorted(Qs&& xs, O out) const
+        {
+            using result_t = std::invoke_result_t<const this_type&, const std::ranges::range_value_t<Qs>&>;
+            const auto grids = std::ranges::begin(grids_.get());
+            const auto values = std::ranges::begin(values_.get());
+            egret_detail::interp1d_impl::for_each_sorted_interval(grids_.get(), xs, less_, [&](const auto& x, auto idx) {
+                const auto w = egret_detail::interp1d_impl::relpos(x).between(grids[idx], grids[idx + 1]);
+                *out = static_cast<result_t>(values[idx] * (1 - w) + values[idx + 1] * w);
+                ++out;
+            });
+            return out;
+        }
+
+        template <std::ranges::input_range Qs, typename O>
+            requires
+                std::ranges::random_access_range<const Xs> &&
+                std::ranges::random_access_range<const Ys> &&
+                requires (const this_type& f, const std::ranges::range_value_t<Qs>& x) { f.der1(x); } &&
+                std::output_iterator<O, decltype(std::declval<const this_type&>().der1(std::declval<const std::ranges::range_value_t<Qs>&>()))>
+        constexpr O der1_sorted(Qs&& xs, O out) const
+        {
+            using result_t = decltype(this->der1(std::declval<const std::ranges::range_value_t<Qs>&>()));
+            const auto grids = std::ranges::begin(grids_.get());
+            const auto values = std::ranges::begin(values_.get());
+            egret_detail::interp1d_impl::for_each_sorted_interval(grids_.get(), xs, less_, [&](const auto&, auto idx) {
+                *out = static_cast<result_t>(values[idx + 1] - values[idx]) / interp1d::distance(grids[idx], grids[idx + 1]);
+                ++out;
+            });
+            return out;
+        }
+
+        template <std::ranges::input_range Qs, typename O>
+            requires
+                requires (const this_type& f, const std::ranges::range_value_t<Qs>& x) { f.der2(x); } &&
+                std::output_iterator<O, decltype(std::declval<const this_type&>().der2(std::declval<const std::ranges::range_value_t<Qs>&>()))>
+        constexpr O der2_sorted(Qs&& xs, O out) const
+        {
+            using result_t = decltype(this->der2(std::declval<const std::ranges::range_value_t<Qs>&>()));
+            for ([[maybe_unused]] auto&& x : xs) {
+                *out = static_cast<result_t>(0);
+                ++out;
+            }
+            return out;
+        }
+
     // -------------------------------------------------------------------------
     //  der
     //
@@ -123,6 +202,23 @@ namespace egret::math::interp1d {
             return static_cast<result_t>(*yrit - *ylit) / interp1d::distance(*xlit, *xrit);
         }
 
+        template <distance_measurable_from<grid_type> X>
+            requires 
+                std::ranges::random_access_range<const Xs> &&
+                std::strict_weak_order<const Less&, const grid_type&, const X&> &&
+                std::common_with<distance_result_t<grid_type>, value_type> &&
+                cpt::vector<std::common_type_t<distance_result_t<grid_type>, value_type>, distance_result_t<grid_type>>
+        constexpr auto der1(const X& x, interval_hint& hint) const
+            -> std::common_type_t<distance_result_t<grid_type>, value_type>
+        {
+            using result_t = std::common_type_t<distance_result_t<grid_type>, value_type>;
+            const auto [xlit, xrit] = util::find_interval_near(grids_.get(), x, hint.index, less_);
+            const auto idx = std::ranges::distance(std::ranges::begin(grids_.get()), xlit);
+            hint.index = idx;
+            const auto [ylit, yrit] = egret_detail::interp1d_impl::interval_at(idx, values_.get());
+            return static_cast<result_t>(*yrit - *ylit) / interp1d::distance(*xlit, *xrit);
+        }
+
         template <distance_measurable_from<grid_type> X>
             requires 
                 std::strict_weak_order<const Less&, const grid_type&, const X&> &&
@@ -308,6 +404,54 @@ namespace egret::math::interp1d {
     linear(Xs, Ys, Less)
         -> linear<std::ranges::range_value_t<Xs>, std::ranges::range_value_t<Ys>, Less>;
 
+// -----------------------------------------------------------------------------
+//  [class] uniform_linear
+// -----------------------------------------------------------------------------
+    /**
+     * @brief linear on equally spaced grids, which locates intervals arithmetically instead of searching.
+    */
+    template <distance_measurable X, distance_measurable Y, typename Less = std::ranges::less>
+        requires std::predicate<const Less&, const X&, const X&>
+    class uniform_linear final : public generic_linear<uniform_grids<X>, std::vector<Y>, Less> {
+    private:
+        using super_type = generic_linear<uniform_grids<X>, std::vector<Y>, Less>;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtors and assigns
+    //
+        using super_type::super_type;
+        using super_type::operator =;
+
+    // -------------------------------------------------------------------------
+    //  mutable behavior
+    //
+        template <cpt::forward_range_of<X> Xs, cpt::forward_range_of<Y> Ys>
+        void initialize(Xs&& xs, Ys&& ys)
+        {
+            egret_detail::interp1d_impl::interpolatee_validation(xs, ys, super_type::less_);
+            super_type::grids_.get() = uniform_grids<X>(std::forward<Xs>(xs));
+            util::vector_assign(super_type::values_.get(), std::forward<Ys>(ys));
+        }
+
+        template <typename AY>
+            requires std::is_assignable_v<Y&, AY>
+        void update(std::size_t i, AY&& value)
+        {
+            egret::assertion(i < super_type::values_.get().size(), "Assigned to out of range element. [size={}, index={}]", super_type::values_.get().size(), i);
+            super_type::values_.get()[i] = std::forward<AY>(value);
+        }
+
+    }; // class uniform_linear
+
+    template <typename X, std::ranges::forward_range Ys>
+    uniform_linear(uniform_grids<X>, Ys)
+        -> uniform_linear<X, std::ranges::range_value_t<Ys>>;
+
+    template <typename X, std::ranges::forward_range Ys, typename Less>
+    uniform_linear(uniform_grids<X>, Ys, Less)
+        -> uniform_linear<X, std::ranges::range_value_t<Ys>, Less>;
+
 } // namespace egret::math::interp1d
 
 namespace nlohmann {
@@ -339,6 +483,35 @@ namespace nlohmann {
         }
     };
 
+    template <typename X, typename Y, typename Less>
+    struct adl_serializer<egret::math::interp1d::uniform_linear<X, Y, Less>> {
+        using target_type = egret::math::interp1d::uniform_linear<X, Y, Less>;
+
+        template <typename Json>
+            requires 
+                std::is_default_constructible_v<Less> &&
+                egret::cpt::deserializable_json_with<Json, egret::util::j2obj::get_t<X>> &&
+                egret::cpt::deserializable_json_with<Json, egret::util::j2obj::get_t<Y>>
+        static target_type from_json(const Json& j)
+        {
+            namespace interp1d = egret::math::interp1d;
+            namespace impl = egret_detail::interp1d_impl;
+            auto [xs, ys] = impl::recover_knots<X, Y>(j);
+            return target_type{interp1d::uniform_grids<X>(std::move(xs)), std::move(ys)};
+        }
+
+        template <typename Json>
+            requires
+                std::is_assignable_v<Json&, const X&> &&
+                std::is_assignable_v<Json&, const Y&>
+        static void to_json(Json& j, const target_type& obj)
+        {
+            namespace interp1d = egret::math::interp1d;
+            namespace interp1d_impl = egret_detail::interp1d_impl;
+            interp1d_impl::records_knots(j, interp1d::grids(obj), interp1d::values(obj));
+        }
+    };
+
     template <typename Xs, typename Ys, typename Less>
     struct adl_serializer<egret::math::interp1d::generic_linear<Xs, Ys, Less>> {
         using target_type = egret::math::interp1d::generic_linear<Xs, Ys, Less>;
@@ -11,9 +11,11 @@
 #include "core/math/algebra/concepts.h"
 
 #include "concepts.h"
+#include "uniform_grids.h"
 #include "auxiliary/interpolatee_validation.h"
 #include "auxiliary/find_index_and_relpos.h"
 #include "auxiliary/interval_at.h"
+#include "auxiliary/sorted_intervals.h"
 #include "auxiliary/json_deserializer_impl.h"
 
 namespace egret::math::interp1d {
@@ -118,6 +120,69 @@ namespace egret::math::interp1d {
             }
         }
 
+        /**
+         * @brief evaluates searching from the interval of hint, and updates hint with the found interval.
+        */
+        template <relpos_computable_from<grid_type> X>
+            requires
+                std::ranges::random_access_range<const Xs> &&
+                std::strict_weak_order<const Less&, const grid_type&, const X&> &&
+                std::strict_weak_order<const Less&, relpos_t<X, grid_type>, const P&>
+        constexpr auto operator()(const X& x, interval_hint& hint) const
+            -> std::ranges::range_reference_t<const Ys>
+        {
+            const auto [idx, w] = egret_detail::interp1d_impl::find_index_and_relpos_near(grids_.get(), x, hint, less_);
+            const auto [ylit, yrit] = egret_detail::interp1d_impl::interval_at(idx, values_.get());
+            if (is_right_continuous_) {
+                return !std::invoke(less_, w, partition_) ? *yrit : *ylit;
+            }
+            else {
+                return !std::invoke(less_, partition_, w) ? *ylit : *yrit;
+            }
+        }
+
+    // -------------------------------------------------------------------------
+    //  sorted batch
+    //
+        /**
+         * @brief evaluates at xs and writes results into out. xs in ascending order are located in O(1) amortized each.
+        */
+        template <std::ranges::input_range Qs, std::output_iterator<std::ranges::range_reference_t<const Ys>> O>
+            requires
+                std::ranges::random_access_range<const Xs> &&
+                std::ranges::random_access_range<const Ys> &&
+                std::invocable<const this_type&, const std::ranges::range_value_t<Qs>&>
+        constexpr O evaluate_sorted(Qs&& xs, O out) const
+        {
+            const auto grids = std::ranges::begin(grids_.get());
+            const auto values = std::ranges::begin(values_.get());
+            egret_detail::interp1d_impl::for_each_sorted_interval(grids_.get(), xs, less_, [&](const auto& x, auto idx) {
+                const auto w = egret_detail::interp1d_impl::relpos(x).between(grids[idx], grids[idx + 1]);
+                const bool right = is_right_continuous_
+                    ? !std::invoke(less_, w, partition_)
+                    : std::invoke(less_, partition_, w);
+                *out = values[idx + static_cast<decltype(idx)>(right)];
+                ++out;
+            });
+            return out;
+        }
+
+        template <std::ranges::input_range Qs, std::output_iterator<value_type> O>
+        constexpr O der1_sorted(Qs&& xs, O out) const
+        {
+            for ([[maybe_unused]] auto&& x : xs) {
+                *out = static_cast<value_type>(0);
+                ++out;
+            }
+            return out;
+        }
+
+        template <std::ranges::input_range Qs, std::output_iterator<value_type> O>
+        constexpr O der2_sorted(Qs&& xs, O out) const
+        {
+            return this->der1_sorted(std::forward<Qs>(xs), std::move(out));
+        }
+
     // -------------------------------------------------------------------------
     //  der
     //
@@ -339,6 +404,64 @@ namespace egret::math::interp1d {
     pwconst(Xs, Ys, P, bool, Less)
         -> pwconst<std::ranges::range_value_t<Xs>, std::ranges::range_value_t<Ys>, P, Less>;
 
+// -----------------------------------------------------------------------------
+//  [class] uniform_pwconst
+// -----------------------------------------------------------------------------
+    /**
+     * @brief pwconst on equally spaced grids, which locates intervals arithmetically instead of searching.
+    */
+    template <
+        distance_measurable X, distance_measurable Y, 
+        cpt::non_reference P = double, std::semiregular Less = std::ranges::less
+    >
+        requires 
+            std::predicate<const Less&, const X&, const X&> &&
+            std::predicate<const Less&, const P&, double> &&
+            std::predicate<const Less&, double, const P&>
+    class uniform_pwconst final : public generic_pwconst<uniform_grids<X>, std::vector<Y>, P, Less> {
+    private:
+        using super_type = generic_pwconst<uniform_grids<X>, std::vector<Y>, P, Less>;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtors and assigns
+    //
+        using super_type::super_type;
+        using super_type::operator =;
+
+    // -------------------------------------------------------------------------
+    //  mutable behavior
+    //
+        template <cpt::forward_range_of<X> Xs, cpt::forward_range_of<Y> Ys>
+        void initialize(Xs&& xs, Ys&& ys)
+        {
+            egret_detail::interp1d_impl::interpolatee_validation(xs, ys, super_type::less_);
+            super_type::grids_.get() = uniform_grids<X>(std::forward<Xs>(xs));
+            util::vector_assign(super_type::values_.get(), std::forward<Ys>(ys));
+        }
+
+        template <typename AY>
+            requires std::is_assignable_v<Y&, AY>
+        void update(std::size_t i, AY&& value)
+        {
+            egret::assertion(i < super_type::values_.get().size(), "Assigned to out of range element. [size={}, index={}]", super_type::values_.get().size(), i);
+            super_type::values_.get()[i] = std::forward<AY>(value);
+        }
+
+    }; // class uniform_pwconst
+
+    template <typename X, std::ranges::forward_range Ys, typename P>
+    uniform_pwconst(uniform_grids<X>, Ys, P) 
+        -> uniform_pwconst<X, std::ranges::range_value_t<Ys>, P>;
+
+    template <typename X, std::ranges::forward_range Ys, typename P>
+    uniform_pwconst(uniform_grids<X>, Ys, P, bool) 
+        -> uniform_pwconst<X, std::ranges::range_value_t<Ys>, P>;
+
+    template <typename X, std::ranges::forward_range Ys, typename P, typename Less>
+    uniform_pwconst(uniform_grids<X>, Ys, P, bool, Less)
+        -> uniform_pwconst<X, std::ranges::range_value_t<Ys>, P, Less>;
+
 } // namespace egret::math::interp1d
 
 namespace nlohmann {
@@ -377,6 +500,42 @@ namespace nlohmann {
         }
     };
 
+    template <typename X, typename Y, typename P, typename Less>
+    struct adl_serializer<egret::math::interp1d::uniform_pwconst<X, Y, P, Less>> {
+        using target_type = egret::math::interp1d::uniform_pwconst<X, Y, P, Less>;
+
+        template <typename Json>
+            requires 
+                std::is_default_constructible_v<Less> &&
+                egret::cpt::deserializable_json_with<Json, egret::util::j2obj::get_t<X>> &&
+                egret::cpt::deserializable_json_with<Json, egret::util::j2obj::get_t<Y>> &&
+                egret::cpt::deserializable_json_with<Json, egret::util::j2obj::get_t<P>>
+        static target_type from_json(const Json& j)
+        {
+            namespace interp1d = egret::math::interp1d;
+            namespace impl = egret_detail::interp1d_impl;
+            namespace j2obj = egret::util::j2obj;
+            const bool is_right_continuous = ("is_right_continuous" >> j2obj::boolean)(j);
+            auto partition_ratio = ("partition_ratio" >> j2obj::get<P>)(j);
+            auto [xs, ys] = impl::recover_knots<X, Y>(j);
+            return target_type{interp1d::uniform_grids<X>(std::move(xs)), std::move(ys), std::move(partition_ratio), is_right_continuous};
+        }
+
+        template <typename Json>
+            requires
+                std::is_assignable_v<Json&, const X&> &&
+                std::is_assignable_v<Json&, const Y&> &&
+                std::is_assignable_v<Json&, const P&>
+        static void to_json(Json& j, const target_type& obj)
+        {
+            namespace interp1d = egret::math::interp1d;
+            namespace interp1d_impl = egret_detail::interp1d_impl;
+            interp1d_impl::records_knots(j, interp1d::grids(obj), interp1d::values(obj));
+            j["is_right_continuous"] = obj.is_right_continuous();
+            j["partition_ratio"] = obj.partition_ratio();
+        }
+    };
+
     template <typename Xs, typename Ys, typename P, typename Less>
     struct adl_serializer<egret::math::interp1d::generic_pwconst<Xs, Ys, P, Less>> {
         using target_type = egret::math::interp1d::generic_pwconst<Xs, Ys, P, Less>;
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <ranges>
+#include <utility>
+#include <functional>
+#include "core/assertions/assertion.h"
+#include "core/assertions/exception.h"
+#include "core/concepts/range_of.h"
+#include "core/utils/range_utils/find_interval.h"
+#include "concepts.h"
+
+namespace egret::math::interp1d {
+// -----------------------------------------------------------------------------
+//  [fn] is_uniform
+// -----------------------------------------------------------------------------
+    /**
+     * @brief whether grids are equally spaced, i.e. each grid is within tolerance * step from first + i * step.
+    */
+    template <std::ranges::forward_range Xs>
+        requires
+            distance_measurable<std::ranges::range_value_t<Xs>> &&
+            std::convertible_to<distance_result_t<std::ranges::range_value_t<Xs>>, double>
+    bool is_uniform(const Xs& grids, double tolerance = 1e-8)
+    {
+        auto it = std::ranges::begin(grids);
+        const auto end = std::ranges::end(grids);
+        if (it == end || std::ranges::next(it) == end) {
+            return false;
+        }
+        const auto& first = *it;
+        const auto step = static_cast<double>(interp1d::distance(first, *std::ranges::next(it)));
+        if (!(step != 0.0)) {
+            return false;
+        }
+        double i = 0.0;
+        for (; it != end; ++it, i += 1.0) {
+            const auto dist = static_cast<double>(interp1d::distance(first, *it));
+            if (!(std::abs(dist - i * step) <= tolerance * std::abs(step))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+// -----------------------------------------------------------------------------
+//  [class] uniform_grids
+// -----------------------------------------------------------------------------
+    /**
+     * @brief read-only equally spaced grids, on which util::find_interval computes the interval arithmetically.
+     * @details
+     *  the knots are stored as well, so that interpolations on them behave the same as on std::vector,
+     *  including boundaries and extrapolation. e.g. daily sys_days grids and time-bucketed double grids.
+    */
+    template <distance_measurable X>
+        requires std::convertible_to<distance_result_t<X>, double>
+    class uniform_grids {
+    private:
+        using this_type = uniform_grids;
+        using storage_type = std::vector<X>;
+
+    public:
+        using value_type = X;
+        using size_type = typename storage_type::size_type;
+        using difference_type = typename storage_type::difference_type;
+        using const_reference = typename storage_type::const_reference;
+        using reference = const_reference;
+        using const_iterator = typename storage_type::const_iterator;
+        using iterator = const_iterator;
+
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        uniform_grids() = default;
+        uniform_grids(const this_type&) = default;
+        uniform_grids(this_type&&) noexcept = default;
+
+        /**
+         * @brief n grids first, first + step, ..., first + (n - 1) * step.
+        */
+        template <typename Step>
+            requires requires (const X& x, const Step& step, std::ptrdiff_t i) { { x + step * i } -> std::convertible_to<X>; }
+        uniform_grids(const X& first, const Step& step, std::size_t n)
+            : elems_(), inv_step_()
+        {
+            const auto width = static_cast<double>(interp1d::distance(first, static_cast<X>(first + step * std::ptrdiff_t(1))));
+            egret::assertion(0. < width, "Step of uniform grids must be positive. [step={}]", width);
+            elems_.reserve(n);
+            for (std::size_t i = 0; i != n; ++i) {
+                elems_.push_back(static_cast<X>(first + step * static_cast<std::ptrdiff_t>(i)));
+            }
+            this->initialize_step();
+        }
+
+        /**
+         * @brief grids detected as equally spaced by is_uniform.
+         * @param tolerance less than 0.5, so that the interval computed arithmetically is off by one at most.
+        */
+        explicit uniform_grids(storage_type elems, double tolerance = 1e-8)
+            : elems_(std::move(elems)), inv_step_()
+        {
+            egret::assertion(0. <= tolerance && tolerance < 0.5, "Tolerance of uniform grids must be in [0, 0.5). [tolerance={}]", tolerance);
+            egret::assertion(interp1d::is_uniform(elems_, tolerance), "Grids are not equally spaced. [size={}, tolerance={}]", elems_.size(), tolerance);
+            this->initialize_step();
+        }
+
+        template <cpt::forward_range_of<X> Rng>
+            requires (!std::same_as<std::remove_cvref_t<Rng>, this_type>)
+        explicit uniform_grids(Rng&& rng, double tolerance = 1e-8)
+            : uniform_grids(storage_type(std::ranges::begin(rng), std::ranges::end(rng)), tolerance)
+        {
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  range
+    //
+        const_iterator begin() const noexcept { return elems_.begin(); }
+        const_iterator end() const noexcept { return elems_.end(); }
+        const_iterator cbegin() const noexcept { return elems_.cbegin(); }
+        const_iterator cend() const noexcept { return elems_.cend(); }
+
+        size_type size() const noexcept { return elems_.size(); }
+        bool empty() const noexcept { return elems_.empty(); }
+        const X* data() const noexcept { return elems_.data(); }
+
+        const_reference operator [](size_type i) const noexcept { return elems_[i]; }
+        const_reference front() const noexcept { return elems_.front(); }
+        const_reference back() const noexcept { return elems_.back(); }
+
+        const storage_type& get() const noexcept { return elems_; }
+
+        /**
+         * @brief distance between adjacent grids.
+        */
+        double step() const noexcept { return 1.0 / inv_step_; }
+
+    // -------------------------------------------------------------------------
+    //  search
+    //
+        /**
+         * @brief same result as util::find_interval on the underlying vector in O(1).
+        */
+        template <typename AX, typename Less = std::ranges::less, typename Proj = std::identity>
+            requires std::strict_weak_order<const Less&, const AX&, std::invoke_result_t<const Proj&, const X&>>
+        auto find_interval(const AX& x, const Less& less = {}, const Proj& proj = {}) const
+            -> std::pair<const_iterator, const_iterator>
+        {
+            constexpr bool is_arithmetic =
+                std::same_as<Proj, std::identity> &&
+                requires (const X& from, const AX& to) { static_cast<double>(interp1d::distance(from, to)); };
+
+            if constexpr (!is_arithmetic) {
+                return util::find_interval_branchless(elems_, x, less, proj);
+            }
+            else {
+                if (elems_.size() < 2) {
+                    throw exception("Range must have 2 elements at least to use find_interval, but has only {}.", elems_.size()).record_stacktrace();
+                }
+                const auto last = elems_.size() - 2;
+                const auto t = static_cast<double>(interp1d::distance(elems_.front(), x)) * inv_step_;
+                auto idx = !(t >= 1.0) ? std::size_t(0)
+                    : t >= static_cast<double>(last) ? last
+                    : static_cast<std::size_t>(t);
+
+                // t may be rounded across a grid, so that the index is corrected by the comparison
+                if (idx < last && !std::invoke(less, x, elems_[idx + 1])) {
+                    ++idx;
+                }
+                else if (idx > 0 && std::invoke(less, x, elems_[idx])) {
+                    --idx;
+                }
+                const auto it = elems_.begin() + static_cast<difference_type>(idx);
+                return std::pair {it, std::ranges::next(it)};
+            }
+        }
+
+    // -------------------------------------------------------------------------
+    //  compare
+    //
+        bool operator ==(const this_type& other) const { return elems_ == other.elems_; }
+
+    private:
+        void initialize_step()
+        {
+            egret::assertion(2 <= elems_.size(), "Uniform grids must have 2 elements at least, but has only {}.", elems_.size());
+            const auto width = static_cast<double>(interp1d::distance(elems_.front(), elems_.back()));
+            inv_step_ = static_cast<double>(elems_.size() - 1) / width;
+        }
+
+    private:
+        storage_type elems_;
+        double inv_step_ = 0.;
+
+    }; // class uniform_grids
+
+    template <typename X>
+    uniform_grids(std::vector<X>) -> uniform_grids<X>;
+
+    template <typename X, typename Step>
+    uniform_grids(X, Step, std::size_t) -> uniform_grids<X>;
+
+} // namespace egret::math::interp1d
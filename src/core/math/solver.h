@@ -1,4 +1,6 @@
 #pragma once
 
 #include "core/math/solver/iteration_result.h"
+#include "core/math/solver/jacobian_matrix.h"
 #include "core/math/solver/newton1d.h"
+#include "core/math/solver/newton_nd.h"
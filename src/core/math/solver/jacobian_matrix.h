@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+#include "core/assertions/assertion.h"
+
+namespace egret::math::solver {
+// -----------------------------------------------------------------------------
+//  [struct] band_width
+// -----------------------------------------------------------------------------
+    /**
+     * @brief numbers of sub and super diagonals of a banded matrix.
+    */
+    struct band_width {
+        std::size_t lower;
+        std::size_t upper;
+    };
+
+// -----------------------------------------------------------------------------
+//  [class] jacobian_matrix
+// -----------------------------------------------------------------------------
+    /**
+     * @brief row major dense or square banded matrix.
+     * @details
+     *  banded matrices keep lower extra super diagonals, so that they can be lu decomposed in place with row pivoting.
+     *  resize keeps the capacity of the storage, so a matrix reused by iterations does not allocate after the first one.
+    */
+    template <std::floating_point X>
+    class jacobian_matrix {
+    private:
+        using this_type = jacobian_matrix;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        jacobian_matrix() = default;
+        jacobian_matrix(const this_type&) = default;
+        jacobian_matrix(this_type&&) noexcept = default;
+
+        jacobian_matrix(std::size_t rows, std::size_t cols)
+        {
+            this->resize(rows, cols);
+        }
+
+        jacobian_matrix(std::size_t n, band_width band)
+        {
+            this->resize(n, band);
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  shape
+    //
+        void resize(std::size_t rows, std::size_t cols)
+        {
+            rows_ = rows;
+            cols_ = cols;
+            band_.reset();
+            width_ = cols;
+            data_.assign(rows_ * width_, X(0));
+        }
+
+        void resize(std::size_t n, band_width band)
+        {
+            rows_ = n;
+            cols_ = n;
+            band_ = band;
+            width_ = 2 * band.lower + band.upper + 1;
+            data_.assign(rows_ * width_, X(0));
+        }
+
+        void set_zero() noexcept { std::ranges::fill(data_, X(0)); }
+
+        std::size_t rows() const noexcept { return rows_; }
+        std::size_t cols() const noexcept { return cols_; }
+        bool is_banded() const noexcept { return band_.has_value(); }
+        const std::optional<band_width>& band() const noexcept { return band_; }
+
+        /**
+         * @brief first and one past the last columns of the structural non zeros in the i-th row.
+        */
+        std::pair<std::size_t, std::size_t> row_range(std::size_t i) const noexcept
+        {
+            if (!band_) {
+                return {0, cols_};
+            }
+            return {
+                i > band_->lower ? i - band_->lower : 0,
+                std::min(cols_, i + band_->upper + 1)
+            };
+        }
+
+        /**
+         * @brief first and one past the last rows of the structural non zeros in the j-th column.
+        */
+        std::pair<std::size_t, std::size_t> col_range(std::size_t j) const noexcept
+        {
+            if (!band_) {
+                return {0, rows_};
+            }
+            return {
+                j > band_->upper ? j - band_->upper : 0,
+                std::min(rows_, j + band_->lower + 1)
+            };
+        }
+
+    // -------------------------------------------------------------------------
+    //  access
+    //
+        /**
+         * @brief element at (i, j). for banded matrices, j must lie in row_range(i) extended by the lower extra super diagonals.
+        */
+        X& operator()(std::size_t i, std::size_t j) { return data_[this->index(i, j)]; }
+        const X& operator()(std::size_t i, std::size_t j) const { return data_[this->index(i, j)]; }
+
+    // -------------------------------------------------------------------------
+    //  lu decomposition
+    //
+        /**
+         * @brief lu decomposes the square matrix in place with partial pivoting.
+         * @details row interchanges are not applied to the multipliers of the former columns, as lapack's getrf/gbtrf.
+         * @return false if the matrix is singular.
+        */
+        bool lu_decompose(std::vector<std::size_t>& pivots)
+        {
+            egret::assertion(rows_ == cols_, "lu_decompose requires a square matrix. [rows={}, cols={}]", rows_, cols_);
+            const std::size_t n = rows_;
+            const std::size_t kl = band_ ? band_->lower : n;
+            const std::size_t ku = band_ ? band_->lower + band_->upper : n;
+            pivots.resize(n);
+            for (std::size_t k = 0; k != n; ++k) {
+                const std::size_t last_row = std::min(n, k + kl + 1);
+                const std::size_t last_col = std::min(n, k + ku + 1);
+                std::size_t piv = k;
+                for (std::size_t i = k + 1; i != last_row; ++i) {
+                    if (std::abs((*this)(i, k)) > std::abs((*this)(piv, k))) {
+                        piv = i;
+                    }
+                }
+                pivots[k] = piv;
+                if ((*this)(piv, k) == X(0)) {
+                    return false;
+                }
+                if (piv != k) {
+                    for (std::size_t j = k; j != last_col; ++j) {
+                        std::swap((*this)(k, j), (*this)(piv, j));
+                    }
+                }
+                const X inv_pivot = X(1) / (*this)(k, k);
+                for (std::size_t i = k + 1; i != last_row; ++i) {
+                    X& m = (*this)(i, k);
+                    if (m == X(0)) {
+                        continue;
+                    }
+                    m *= inv_pivot;
+                    for (std::size_t j = k + 1; j != last_col; ++j) {
+                        (*this)(i, j) -= m * (*this)(k, j);
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief solves a x = b by the result of lu_decompose. b is overwritten by x.
+        */
+        void lu_solve(const std::vector<std::size_t>& pivots, std::span<X> b) const
+        {
+            const std::size_t n = rows_;
+            const std::size_t kl = band_ ? band_->lower : n;
+            const std::size_t ku = band_ ? band_->lower + band_->upper : n;
+            for (std::size_t k = 0; k != n; ++k) {
+                if (pivots[k] != k) {
+                    std::swap(b[k], b[pivots[k]]);
+                }
+                const std::size_t last_row = std::min(n, k + kl + 1);
+                for (std::size_t i = k + 1; i != last_row; ++i) {
+                    b[i] -= (*this)(i, k) * b[k];
+                }
+            }
+            for (std::size_t k = n; k-- != 0;) {
+                const std::size_t last_col = std::min(n, k + ku + 1);
+                X s = b[k];
+                for (std::size_t j = k + 1; j != last_col; ++j) {
+                    s -= (*this)(k, j) * b[j];
+                }
+                b[k] = s / (*this)(k, k);
+            }
+        }
+
+    private:
+        std::size_t index(std::size_t i, std::size_t j) const
+        {
+            egret::debug_assert(
+                i < rows_ && j < cols_ && (!band_ || (i <= j + band_->lower && j <= i + band_->lower + band_->upper)),
+                "jacobian_matrix element is out of the stored band. [i={}, j={}, rows={}, cols={}]", i, j, rows_, cols_
+            );
+            // banded: column j of the i-th row is stored at offset j - i + lower
+            return band_ ? i * width_ + (j + band_->lower - i) : i * width_ + j;
+        }
+
+    private:
+        std::size_t rows_ = 0;
+        std::size_t cols_ = 0;
+        std::size_t width_ = 0;
+        std::optional<band_width> band_;
+        std::vector<X> data_;
+
+    }; // class jacobian_matrix
+
+} // namespace egret::math::solver
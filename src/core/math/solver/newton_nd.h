@@ -0,0 +1,357 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+#include "core/assertions/exception.h"
+#include "iteration_result.h"
+#include "jacobian_matrix.h"
+
+namespace egret::math::solver {
+// -----------------------------------------------------------------------------
+//  [struct] nd_solver_config
+//  [struct] nd_iteration_log
+// -----------------------------------------------------------------------------
+    struct nd_solver_config {
+        double residual_tolerance = 1e-10;  // max |residual| to stop iterations
+        double step_tolerance = 1e-14;      // max |step| to stop iterations
+        std::size_t max_iter = 100;
+        std::size_t max_line_search = 16;   // newton_nd: max number of step halvings
+        double initial_damping = 1e-3;      // levenberg_marquardt: initial damping factor
+        double damping_scale = 10.;         // levenberg_marquardt: factor to update the damping
+        double max_damping = 1e16;          // levenberg_marquardt: the iteration fails above this damping
+    };
+
+    template <typename X>
+    struct nd_iteration_log {
+        X residual_norm;    // max |residual| after the step
+        X step_norm;        // max |step|
+        X damping;          // step length of the line search for newton_nd, damping factor for levenberg_marquardt
+    };
+
+// -----------------------------------------------------------------------------
+//  [class] nd_solver_workspace
+// -----------------------------------------------------------------------------
+    /**
+     * @brief buffers of newton_nd and levenberg_marquardt.
+     * @details
+     *  passing the same workspace to repeated calibrations avoids allocations once it has grown to the problem size.
+    */
+    template <std::floating_point X>
+    struct nd_solver_workspace {
+        jacobian_matrix<X> jacobian;
+        jacobian_matrix<X> normal;
+        jacobian_matrix<X> factorized;
+        std::vector<X> residual;
+        std::vector<X> trial_residual;
+        std::vector<X> trial;
+        std::vector<X> step;
+        std::vector<X> gradient;
+        std::vector<std::size_t> pivots;
+
+        /**
+         * @param m number of residuals
+         * @param n number of parameters
+         * @param band band width of the jacobian. the system must be square (m == n) if it is given.
+        */
+        void prepare(std::size_t m, std::size_t n, const std::optional<band_width>& band)
+        {
+            if (band) {
+                egret::assertion(m == n, "Banded jacobian requires a square system. [residuals={}, parameters={}]", m, n);
+                jacobian.resize(n, *band);
+            }
+            else {
+                jacobian.resize(m, n);
+            }
+            residual.resize(m);
+            trial_residual.resize(m);
+            trial.resize(n);
+            step.resize(n);
+            gradient.resize(n);
+            pivots.resize(n);
+        }
+    };
+
+} // namespace egret::math::solver
+
+namespace egret_detail::newton_nd_impl {
+    template <typename X>
+    X max_abs(std::span<const X> xs) noexcept
+    {
+        X result = X(0);
+        for (const X& x : xs) {
+            result = std::max(result, std::abs(x));
+        }
+        return result;
+    }
+
+    template <typename X>
+    X sum_sq(std::span<const X> xs) noexcept
+    {
+        X result = X(0);
+        for (const X& x : xs) {
+            result += x * x;
+        }
+        return result;
+    }
+
+    // normal = J^T J and step = J^T r. the band of J^T J is the sum of the lower and upper bands of J.
+    template <typename X>
+    void normal_equations(
+        const egret::math::solver::jacobian_matrix<X>& jac, std::span<const X> r,
+        egret::math::solver::jacobian_matrix<X>& normal, std::span<X> g
+    )
+    {
+        const std::size_t n = jac.cols();
+        if (const auto& band = jac.band()) {
+            const std::size_t b = band->lower + band->upper;
+            if (normal.rows() != n || !normal.is_banded() || normal.band()->lower != b || normal.band()->upper != b) {
+                normal.resize(n, {b, b});
+            }
+        }
+        else if (normal.rows() != n || normal.cols() != n || normal.is_banded()) {
+            normal.resize(n, n);
+        }
+
+        for (std::size_t i = 0; i != n; ++i) {
+            const auto [ri_first, ri_last] = jac.col_range(i);
+            X gi = X(0);
+            for (std::size_t k = ri_first; k != ri_last; ++k) {
+                gi += jac(k, i) * r[k];
+            }
+            g[i] = gi;
+
+            const auto [j_first, j_last] = normal.row_range(i);
+            for (std::size_t j = std::max(i, j_first); j != j_last; ++j) {
+                const auto [rj_first, rj_last] = jac.col_range(j);
+                X s = X(0);
+                for (std::size_t k = std::max(ri_first, rj_first), last = std::min(ri_last, rj_last); k < last; ++k) {
+                    s += jac(k, i) * jac(k, j);
+                }
+                normal(i, j) = s;
+                normal(j, i) = s;
+            }
+        }
+    }
+
+} // namespace egret_detail::newton_nd_impl
+
+namespace egret::math::solver {
+// -----------------------------------------------------------------------------
+//  [fn] newton_nd
+// -----------------------------------------------------------------------------
+    /**
+     * @brief Newton-raphson solver of a square system with backtracking line search.
+     * @details
+     *  the step is halved up to max_line_search times until max |residual| decreases. the iteration fails
+     *  if no halved step decreases it, so that the caller may fall back to levenberg_marquardt.
+     * @param residual (x, r) -> void. writes residuals at x into r.
+     * @param jacobian (x, jac) -> void. writes non zero elements of the jacobian at x into jac, which is zero filled.
+     * @param initial initial value of iteration. pass the previous solution to warm start.
+     * @param band band width of the jacobian if it is banded.
+     * @param ws workspace reused between calls.
+    */
+    template <typename R, typename J, std::floating_point X>
+        requires
+            std::invocable<const R&, std::span<const X>, std::span<X>> &&
+            std::invocable<const J&, std::span<const X>, jacobian_matrix<X>&>
+    auto newton_nd(
+        const R& residual, const J& jacobian, std::vector<X> initial,
+        const nd_solver_config& config, const std::optional<band_width>& band, nd_solver_workspace<X>& ws
+    ) -> iteration_result<std::vector<X>, nd_iteration_log<X>>
+    {
+        namespace impl = egret_detail::newton_nd_impl;
+        iteration_result<std::vector<X>, nd_iteration_log<X>> result;
+        try {
+            const std::size_t n = initial.size();
+            ws.prepare(n, n, band);
+            auto x = std::move(initial);
+            std::invoke(residual, std::span<const X>(x), std::span<X>(ws.residual));
+            X norm = impl::max_abs(std::span<const X>(ws.residual));
+            std::size_t i = 0;
+            for (; i != config.max_iter; ++i) {
+                if (norm <= config.residual_tolerance) {
+                    break;
+                }
+                ws.jacobian.set_zero();
+                std::invoke(jacobian, std::span<const X>(x), ws.jacobian);
+                if (!ws.jacobian.lu_decompose(ws.pivots)) {
+                    throw exception("Jacobian is singular. [iter={}]", i);
+                }
+                std::ranges::copy(ws.residual, ws.step.begin());
+                ws.jacobian.lu_solve(ws.pivots, std::span<X>(ws.step));
+
+                // halve the step while it does not decrease the residual
+                X t = X(1);
+                X trial_norm = norm;
+                for (std::size_t l = 0;; ++l) {
+                    for (std::size_t k = 0; k != n; ++k) {
+                        ws.trial[k] = x[k] - t * ws.step[k];
+                    }
+                    std::invoke(residual, std::span<const X>(ws.trial), std::span<X>(ws.trial_residual));
+                    trial_norm = impl::max_abs(std::span<const X>(ws.trial_residual));
+                    if (trial_norm < norm || l == config.max_line_search) {
+                        break;
+                    }
+                    t *= X(0.5);
+                }
+                if (!std::isfinite(trial_norm)) {
+                    throw exception("Some invalid computation is detected. [iter={}]", i);
+                }
+                if (!(trial_norm < norm)) {
+                    throw exception("Line search does not decrease the residual. [iter={}, max_residual={}, step_length={}]", i, norm, t);
+                }
+                const X step_norm = t * impl::max_abs(std::span<const X>(ws.step));
+                std::swap(x, ws.trial);
+                std::swap(ws.residual, ws.trial_residual);
+                norm = trial_norm;
+                result.push(i, {.residual_norm = norm, .step_norm = step_norm, .damping = t});
+                if (step_norm <= config.step_tolerance) {
+                    ++i;
+                    break;
+                }
+            }
+            if (norm > config.residual_tolerance) {
+                throw exception("newton_nd does not converged. [iter={}, max_residual={}]", i, norm);
+            }
+            result.set_result(std::move(x));
+        }
+        catch (const exception& e) {
+            result.set_error(e);
+        }
+        catch (const std::exception& e) {
+            result.set_error(exception(e.what()).record_stacktrace());
+        }
+        catch (...) {
+            result.set_error(exception("newton_nd is failed with unexpected error.").record_stacktrace());
+        }
+        return result;
+    }
+
+    template <typename R, typename J, std::floating_point X>
+        requires
+            std::invocable<const R&, std::span<const X>, std::span<X>> &&
+            std::invocable<const J&, std::span<const X>, jacobian_matrix<X>&>
+    auto newton_nd(
+        const R& residual, const J& jacobian, std::vector<X> initial,
+        const nd_solver_config& config = {}, const std::optional<band_width>& band = std::nullopt
+    ) -> iteration_result<std::vector<X>, nd_iteration_log<X>>
+    {
+        auto ws = nd_solver_workspace<X> {};
+        return newton_nd(residual, jacobian, std::move(initial), config, band, ws);
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] levenberg_marquardt
+// -----------------------------------------------------------------------------
+    /**
+     * @brief Levenberg-Marquardt solver of least squares min |r(x)|^2.
+     * @details
+     *  steps solve (J^T J + lambda diag(J^T J)) dx = J^T r. the normal matrix keeps the band of the jacobian.
+     *  lambda is divided by damping_scale when a step decreases |r|^2, and multiplied otherwise.
+     * @param residual (x, r) -> void. writes m residuals at x into r.
+     * @param jacobian (x, jac) -> void. writes non zero elements of the m x n jacobian at x into jac, which is zero filled.
+     * @param initial initial value of iteration. pass the previous solution to warm start.
+     * @param m number of residuals.
+     * @param band band width of the jacobian if it is banded. requires m == initial.size().
+     * @param ws workspace reused between calls.
+    */
+    template <typename R, typename J, std::floating_point X>
+        requires
+            std::invocable<const R&, std::span<const X>, std::span<X>> &&
+            std::invocable<const J&, std::span<const X>, jacobian_matrix<X>&>
+    auto levenberg_marquardt(
+        const R& residual, const J& jacobian, std::vector<X> initial, std::size_t m,
+        const nd_solver_config& config, const std::optional<band_width>& band, nd_solver_workspace<X>& ws
+    ) -> iteration_result<std::vector<X>, nd_iteration_log<X>>
+    {
+        namespace impl = egret_detail::newton_nd_impl;
+        iteration_result<std::vector<X>, nd_iteration_log<X>> result;
+        try {
+            const std::size_t n = initial.size();
+            ws.prepare(m, n, band);
+            auto x = std::move(initial);
+            const auto gradient = std::span<X>(ws.gradient);
+            const auto step = std::span<X>(ws.step);
+            std::invoke(residual, std::span<const X>(x), std::span<X>(ws.residual));
+            X cost = impl::sum_sq(std::span<const X>(ws.residual));
+            X lambda = static_cast<X>(config.initial_damping);
+            std::size_t i = 0;
+            bool converged = impl::max_abs(std::span<const X>(ws.residual)) <= config.residual_tolerance;
+            for (; i != config.max_iter && !converged; ++i) {
+                ws.jacobian.set_zero();
+                std::invoke(jacobian, std::span<const X>(x), ws.jacobian);
+                impl::normal_equations(ws.jacobian, std::span<const X>(ws.residual), ws.normal, gradient);
+                if (impl::max_abs(std::span<const X>(ws.gradient)) == X(0)) {
+                    break;
+                }
+
+                // raise lambda until the step decreases the cost
+                X trial_cost = cost;
+                while (true) {
+                    ws.factorized = ws.normal;
+                    for (std::size_t k = 0; k != n; ++k) {
+                        const X d = ws.normal(k, k);
+                        ws.factorized(k, k) += lambda * (d > X(0) ? d : X(1));
+                    }
+                    if (ws.factorized.lu_decompose(ws.pivots)) {
+                        std::ranges::copy(gradient, step.begin());
+                        ws.factorized.lu_solve(ws.pivots, step);
+                        for (std::size_t k = 0; k != n; ++k) {
+                            ws.trial[k] = x[k] - step[k];
+                        }
+                        std::invoke(residual, std::span<const X>(ws.trial), std::span<X>(ws.trial_residual));
+                        trial_cost = impl::sum_sq(std::span<const X>(ws.trial_residual));
+                        if (std::isfinite(trial_cost) && trial_cost < cost) {
+                            break;
+                        }
+                    }
+                    lambda *= static_cast<X>(config.damping_scale);
+                    if (lambda > config.max_damping) {
+                        throw exception("Levenberg-Marquardt damping diverges. [iter={}, cost={}]", i, cost);
+                    }
+                }
+                const X step_norm = impl::max_abs(std::span<const X>(ws.step));
+                std::swap(x, ws.trial);
+                std::swap(ws.residual, ws.trial_residual);
+                cost = trial_cost;
+                const X norm = impl::max_abs(std::span<const X>(ws.residual));
+                result.push(i, {.residual_norm = norm, .step_norm = step_norm, .damping = lambda});
+                lambda /= static_cast<X>(config.damping_scale);
+                converged = norm <= config.residual_tolerance || step_norm <= config.step_tolerance;
+            }
+            if (!converged && i == config.max_iter) {
+                throw exception("levenberg_marquardt does not converged. [iter={}, cost={}]", i, cost);
+            }
+            result.set_result(std::move(x));
+        }
+        catch (const exception& e) {
+            result.set_error(e);
+        }
+        catch (const std::exception& e) {
+            result.set_error(exception(e.what()).record_stacktrace());
+        }
+        catch (...) {
+            result.set_error(exception("levenberg_marquardt is failed with unexpected error.").record_stacktrace());
+        }
+        return result;
+    }
+
+    template <typename R, typename J, std::floating_point X>
+        requires
+            std::invocable<const R&, std::span<const X>, std::span<X>> &&
+            std::invocable<const J&, std::span<const X>, jacobian_matrix<X>&>
+    auto levenberg_marquardt(
+        const R& residual, const J& jacobian, std::vector<X> initial, std::size_t m,
+        const nd_solver_config& config = {}, const std::optional<band_width>& band = std::nullopt
+    ) -> iteration_result<std::vector<X>, nd_iteration_log<X>>
+    {
+        auto ws = nd_solver_workspace<X> {};
+        return levenberg_marquardt(residual, jacobian, std::move(initial), m, config, band, ws);
+    }
+
+} // namespace egret::math::solver
@@ -1,4 +1,5 @@
 #pragma once
 
 #include "core/utils/range_utils/find_interval.h"
+#include "core/utils/range_utils/sorted_vector.h"
 #include "core/utils/range_utils/vector_assign.h"
@@ -3,6 +3,7 @@
 #include <ranges>
 #include <optional>
 #include <algorithm>
+#include <functional>
 #include "core/assertions/exception.h"
 
 namespace egret::util {
@@ -21,7 +22,11 @@ namespace egret::util {
     constexpr auto find_interval(Xs&& xs, const X& x, Less less = {}, Proj&& proj = {})
         -> std::pair<std::ranges::iterator_t<Xs>, std::ranges::iterator_t<Xs>>
     {
-        if constexpr (std::ranges::random_access_range<Xs>) {
+        if constexpr (requires { xs.find_interval(x, less, proj); }) {
+            // ranges carrying their own search accelerator, e.g. util::sorted_vector
+            return xs.find_interval(x, less, proj);
+        }
+        else if constexpr (std::ranges::random_access_range<Xs>) {
             const auto beg = std::ranges::begin(xs);
             const auto end = std::ranges::end(xs);
             const auto sz = end - beg;
@@ -57,4 +62,103 @@ namespace egret::util {
         }
     }
 
+// -----------------------------------------------------------------------------
+//  [fn] find_interval_branchless
+// -----------------------------------------------------------------------------
+    /**
+     * @brief find_interval by a binary search whose comparison selects the next base instead of a branch.
+     * @details
+     *  the loop runs ceil(log2(n)) times regardless of x, and compilers emit a conditional move for the step,
+     *  which avoids mispredictions on large grids queried in random order.
+    */
+    template <
+        std::ranges::random_access_range Xs, 
+        typename X, 
+        typename Proj = std::identity,
+        std::indirect_strict_weak_order<
+            const X*,
+            std::projected<std::ranges::iterator_t<Xs>, Proj>
+        > Less = std::ranges::less
+    >
+    constexpr auto find_interval_branchless(Xs&& xs, const X& x, Less less = {}, Proj&& proj = {})
+        -> std::pair<std::ranges::iterator_t<Xs>, std::ranges::iterator_t<Xs>>
+    {
+        using diff_t = std::ranges::range_difference_t<Xs>;
+        const auto beg = std::ranges::begin(xs);
+        const diff_t sz = std::ranges::end(xs) - beg;
+        if (sz < 2) {
+            throw exception("Range must have 2 elements at least to use find_interval, but has only {}.", sz).record_stacktrace();
+        }
+        // the interval index lies in [base, base + n)
+        auto base = beg;
+        auto n = sz - 1;
+        while (n > 1) {
+            const auto half = n / 2;
+            base += std::invoke(less, x, std::invoke(proj, base[half])) ? diff_t(0) : half;
+            n -= half;
+        }
+        return std::pair {base, std::ranges::next(base)};
+    }
+
+// -----------------------------------------------------------------------------
+//  [fn] find_interval_near
+// -----------------------------------------------------------------------------
+    /**
+     * @brief find_interval starting from the hint, the index of the interval found by the previous call.
+     * @details
+     *  checks the interval at hint and its neighbours first, and gallops away from hint otherwise.
+     *  queries moving monotonically from one call to the next cost O(1) amortized.
+    */
+    template <
+        std::ranges::random_access_range Xs, 
+        typename X, 
+        typename Proj = std::identity,
+        std::indirect_strict_weak_order<
+            const X*,
+            std::projected<std::ranges::iterator_t<Xs>, Proj>
+        > Less = std::ranges::less
+    >
+    constexpr auto find_interval_near(Xs&& xs, const X& x, std::ranges::range_difference_t<Xs> hint, Less less = {}, Proj&& proj = {})
+        -> std::pair<std::ranges::iterator_t<Xs>, std::ranges::iterator_t<Xs>>
+    {
+        using diff_t = std::ranges::range_difference_t<Xs>;
+        const auto beg = std::ranges::begin(xs);
+        const diff_t sz = std::ranges::end(xs) - beg;
+        if (sz < 2) {
+            throw exception("Range must have 2 elements at least to use find_interval, but has only {}.", sz).record_stacktrace();
+        }
+        const auto last = sz - 2;
+        const auto at = [&](auto i) -> decltype(auto) { return std::invoke(proj, beg[i]); };
+        auto h = std::clamp<diff_t>(hint, 0, last);
+
+        if (!less(x, at(h))) {
+            // xs[h] <= x: gallop forward while xs[lo + step] <= x
+            auto lo = h;
+            diff_t step = 1;
+            while (lo + step <= last && !less(x, at(lo + step))) {
+                lo += step;
+                step *= 2;
+            }
+            const auto hi = std::min(lo + step, last + 1);
+            const auto it = std::ranges::upper_bound(beg + lo + 1, beg + hi, x, less, proj);
+            return std::pair {std::ranges::prev(it), it};
+        }
+        if (h == 0) {
+            return std::pair {beg, std::ranges::next(beg)};
+        }
+        // x < xs[h]: gallop backward while x < xs[hi - step]
+        auto hi = h;
+        diff_t step = 1;
+        while (step <= hi && less(x, at(hi - step))) {
+            hi -= step;
+            step *= 2;
+        }
+        const auto lo = step <= hi ? hi - step : 0;
+        auto it = std::ranges::upper_bound(beg + lo, beg + hi, x, less, proj);
+        if (it != beg) {
+            --it;
+        }
+        return std::pair {it, std::ranges::next(it)};
+    }
+
 } // namespace egret::util
\ No newline at end of file
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <bit>
+#include <vector>
+#include <ranges>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include "core/assertions/assertion.h"
+#include "core/assertions/exception.h"
+#include "core/concepts/range_of.h"
+#include "find_interval.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace egret_detail::sorted_vector_impl {
+// -----------------------------------------------------------------------------
+//  [fn] prefetch
+// -----------------------------------------------------------------------------
+    inline void prefetch(const void* p) noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(p);
+#else
+        static_cast<void>(p);
+#endif
+    }
+
+} // namespace egret_detail::sorted_vector_impl
+
+namespace egret::util {
+// -----------------------------------------------------------------------------
+//  [enum] search_layout
+// -----------------------------------------------------------------------------
+    enum class search_layout {
+        branchless,     // binary search selecting the next base by a conditional move
+        eytzinger,      // breadth-first copy of grids searched top-down with prefetches
+    };
+
+// -----------------------------------------------------------------------------
+//  [class] sorted_vector
+// -----------------------------------------------------------------------------
+    /**
+     * @brief read-only sorted vector which accelerates util::find_interval on it.
+     * @details
+     *  use it as grids of interpolations, e.g. generic_linear<sorted_vector<double>, std::vector<double>>,
+     *  to select the search per interpolation. search_layout::branchless suits grids fitting in cache,
+     *  and search_layout::eytzinger, which keeps an extra copy of grids and their indices, suits larger ones.
+     *  elements must be strictly increasing, as grids of interpolations are, which the constructor asserts.
+     *  find_interval must be called with a comparison consistent with std::ranges::less.
+    */
+    template <typename T, search_layout Layout = search_layout::eytzinger>
+    class sorted_vector {
+    private:
+        using this_type = sorted_vector;
+        using storage_type = std::vector<T>;
+
+    public:
+        using value_type = T;
+        using size_type = typename storage_type::size_type;
+        using difference_type = typename storage_type::difference_type;
+        using const_reference = typename storage_type::const_reference;
+        using reference = const_reference;
+        using const_iterator = typename storage_type::const_iterator;
+        using iterator = const_iterator;
+
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        sorted_vector() = default;
+        sorted_vector(const this_type&) = default;
+        sorted_vector(this_type&&) noexcept = default;
+
+        explicit sorted_vector(storage_type elems)
+            : elems_(std::move(elems)), keys_(), indices_()
+        {
+            const auto it = std::ranges::adjacent_find(elems_, std::ranges::greater_equal {});
+            egret::assertion(
+                it == elems_.end(),
+                "Elements of sorted_vector must be strictly increasing. [index={}]",
+                std::ranges::distance(elems_.begin(), it)
+            );
+            this->build();
+        }
+
+        template <cpt::forward_range_of<T> Rng>
+            requires (!std::same_as<std::remove_cvref_t<Rng>, this_type>)
+        explicit sorted_vector(Rng&& rng)
+            : sorted_vector(storage_type(std::ranges::begin(rng), std::ranges::end(rng)))
+        {
+        }
+
+        sorted_vector(std::initializer_list<T> elems)
+            : sorted_vector(storage_type(elems))
+        {
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  range
+    //
+        const_iterator begin() const noexcept { return elems_.begin(); }
+        const_iterator end() const noexcept { return elems_.end(); }
+        const_iterator cbegin() const noexcept { return elems_.cbegin(); }
+        const_iterator cend() const noexcept { return elems_.cend(); }
+
+        size_type size() const noexcept { return elems_.size(); }
+        bool empty() const noexcept { return elems_.empty(); }
+        const T* data() const noexcept { return elems_.data(); }
+
+        const_reference operator [](size_type i) const noexcept { return elems_[i]; }
+        const_reference front() const noexcept { return elems_.front(); }
+        const_reference back() const noexcept { return elems_.back(); }
+
+        const storage_type& get() const noexcept { return elems_; }
+
+    // -------------------------------------------------------------------------
+    //  search
+    //
+        /**
+         * @brief same result as util::find_interval on the underlying vector.
+        */
+        template <typename X, typename Less = std::ranges::less, typename Proj = std::identity>
+            requires std::strict_weak_order<const Less&, const X&, std::invoke_result_t<const Proj&, const T&>>
+        auto find_interval(const X& x, const Less& less = {}, const Proj& proj = {}) const
+            -> std::pair<const_iterator, const_iterator>
+        {
+            if constexpr (Layout == search_layout::branchless) {
+                return util::find_interval_branchless(elems_, x, less, proj);
+            }
+            else {
+                if (elems_.size() < 2) {
+                    throw exception("Range must have 2 elements at least to use find_interval, but has only {}.", elems_.size()).record_stacktrace();
+                }
+                // the interval index is the number of elems_[1], ..., elems_[n - 2] not greater than x,
+                // which is given by the upper bound among them
+                constexpr std::size_t stride = std::max<std::size_t>(1, 64 / sizeof(T));
+                const auto m = keys_.size();
+                std::size_t k = 1;
+                while (k <= m) {
+                    // descendants several levels below share a cache line
+                    if (stride * k <= m) {
+                        egret_detail::sorted_vector_impl::prefetch(keys_.data() + (stride * k - 1));
+                    }
+                    k = 2 * k + static_cast<std::size_t>(!std::invoke(less, x, std::invoke(proj, keys_[k - 1])));
+                }
+                // back to the last node where the search turned left, which is the upper bound
+                k >>= std::countr_one(k) + 1;
+                const auto idx = k == 0 ? m : indices_[k - 1];
+                const auto it = elems_.begin() + static_cast<difference_type>(idx);
+                return std::pair {it, std::ranges::next(it)};
+            }
+        }
+
+    // -------------------------------------------------------------------------
+    //  compare
+    //
+        bool operator ==(const this_type& other) const { return elems_ == other.elems_; }
+
+    private:
+        void build()
+        {
+            if constexpr (Layout == search_layout::eytzinger) {
+                const auto m = elems_.size() < 2 ? std::size_t(0) : elems_.size() - 2;
+                keys_.clear();
+                if (m != 0) {
+                    keys_.assign(m, elems_[1]);
+                }
+                indices_.assign(m, 0);
+                std::size_t i = 0;
+                this->build(1, i);
+            }
+        }
+
+        // in-order traversal of the implicit tree (children of k are 2k and 2k + 1) visits elements in sorted order
+        void build(std::size_t k, std::size_t& i)
+        {
+            if (k <= keys_.size()) {
+                this->build(2 * k, i);
+                keys_[k - 1] = elems_[i + 1];
+                indices_[k - 1] = i;
+                ++i;
+                this->build(2 * k + 1, i);
+            }
+        }
+
+    private:
+        storage_type elems_;
+        storage_type keys_;
+        std::vector<std::size_t> indices_;
+
+    }; // class sorted_vector
+
+    template <typename T>
+    sorted_vector(std::vector<T>) -> sorted_vector<T>;
+
+} // namespace egret::util
@@ -8,6 +8,11 @@ namespace egret::chrono {
 // -----------------------------------------------------------------------------
 //  [class] add_bd
 // -----------------------------------------------------------------------------
+    /**
+     * @brief moves a date to the count-th business day strictly after (count > 0) or before (count < 0) it.
+     * @details
+     *  a holiday start date is not rolled to a business day first, e.g. add_bd(1) of a saturday is the next monday.
+    */
     class add_bd : public adjustment_interface<add_bd> {
     private:
         using this_type = add_bd;
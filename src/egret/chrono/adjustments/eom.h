@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <compare>
+#include "core/chrono/civil.h"
 #include "adjustment_interface.h"
 
 namespace egret::chrono {
@@ -33,10 +34,8 @@ namespace egret::chrono {
     //
         constexpr std::chrono::sys_days operator()(const std::chrono::sys_days& d) const
         {
-            const std::chrono::year_month_day ymd {d};
-            std::chrono::year_month_day_last eom {ymd.year(), std::chrono::month_day_last{ymd.month()}};
-            eom += std::chrono::months(next_);
-            return eom;
+            const auto c = chrono::add_months(chrono::to_civil(d), next_);
+            return chrono::from_civil(c.year, c.month, chrono::last_day_of_month(c.year, c.month));
         }
         constexpr std::chrono::sys_seconds operator()(const std::chrono::sys_seconds& s) const
         {
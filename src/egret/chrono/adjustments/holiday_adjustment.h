@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <span>
 #include "core/chrono/calendars/calendar.h"
 #include "adjustment_interface.h"
 
@@ -52,11 +53,11 @@ namespace egret_detail::hadj_impl {
         return hadj_impl::adjust(d, cal, type_constant<type>{}) + (dt - d);
     }
 
-    std::chrono::sys_days adjust(const std::chrono::sys_days& d, const egret::chrono::calendar&, type_constant<egret::chrono::holiday_adjustment_type::unadjust>)
+    inline std::chrono::sys_days adjust(const std::chrono::sys_days& d, const egret::chrono::calendar&, type_constant<egret::chrono::holiday_adjustment_type::unadjust>)
     {
         return d;
     }
-    std::chrono::sys_seconds adjust(const std::chrono::sys_seconds& dt, const egret::chrono::calendar&, type_constant<egret::chrono::holiday_adjustment_type::unadjust>)
+    inline std::chrono::sys_seconds adjust(const std::chrono::sys_seconds& dt, const egret::chrono::calendar&, type_constant<egret::chrono::holiday_adjustment_type::unadjust>)
     {
         return dt;
     }
@@ -147,6 +148,19 @@ namespace egret::chrono {
     auto adjust(const std::chrono::sys_days& d, const calendar& cal, holiday_adjustment_type type) -> std::chrono::sys_days;
     auto adjust(const std::chrono::sys_seconds& dt, const calendar& cal, holiday_adjustment_type type) -> std::chrono::sys_seconds;
 
+    /**
+     * @brief adjust dates at once. result[i] = adjust(ds[i], cal, type).
+     * @details
+     *  holidays are classified in bulk by calendar::is_holiday and only those are adjusted one by one.
+     *  result may be the same range as ds.
+    */
+    void adjust(
+        std::span<const std::chrono::sys_days> ds,
+        std::span<std::chrono::sys_days> result,
+        const calendar& cal,
+        holiday_adjustment_type type
+    );
+
 // -----------------------------------------------------------------------------
 //  [class] holiday_adjustment
 // -----------------------------------------------------------------------------
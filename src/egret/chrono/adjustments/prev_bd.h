@@ -33,11 +33,7 @@ namespace egret::chrono {
     //
         auto operator()(const std::chrono::sys_days& d) const -> std::chrono::sys_days
         {
-            auto result = d;
-            while (cal_.is_holiday(d)) {
-                result -= std::chrono::days(1);
-            }
-            return result;
+            return chrono::prev_businessday(cal_, d);
         }
         std::chrono::sys_seconds operator()(const std::chrono::sys_seconds& s) const
         {
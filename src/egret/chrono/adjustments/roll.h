@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include "core/chrono/civil.h"
 #include "adjustment_interface.h"
 
 namespace egret::chrono {
@@ -35,7 +37,7 @@ namespace egret::chrono {
         }
 
         constexpr roll(std::chrono::day day, bool modifiy_to_eom) noexcept
-            : roll(day, 0, false)
+            : roll(day, 0, modifiy_to_eom)
         {
         }
 
@@ -47,16 +49,15 @@ namespace egret::chrono {
     //
         constexpr std::chrono::sys_days operator()(const std::chrono::sys_days& d) const
         {
-            const std::chrono::year_month_day ymd {d};
-            const auto ym = std::chrono::year_month {ymd.year(), ymd.month()}
-                + std::chrono::months{ymd.day() <= day_ ? next_ : next_ + 1};
-            const auto rolled = ym / day_;
+            const auto c = chrono::to_civil(d);
+            const auto day = static_cast<std::uint32_t>(static_cast<unsigned>(day_));
+            const auto rolled = chrono::add_months({c.year, c.month, day}, c.day <= day ? next_ : next_ + 1);
 
-            if (modify_to_eom_ && !rolled.ok()) {
-                return std::chrono::year_month_day_last(rolled.year(), std::chrono::month_day_last{rolled.month()});
+            if (const auto last = chrono::last_day_of_month(rolled.year, rolled.month); modify_to_eom_ && last < day) {
+                return chrono::from_civil(rolled.year, rolled.month, last);
             }
             else {
-                return std::chrono::sys_days(rolled);
+                return chrono::from_civil(rolled);
             }
         }
         
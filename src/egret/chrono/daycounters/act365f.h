@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <compare>
+#include <span>
 
 namespace egret::chrono {
 // -----------------------------------------------------------------------------
@@ -24,6 +25,33 @@ namespace egret::chrono {
             return (to - from).count() * secs_per_days;
         }
 
+        /**
+         * @brief bulk version. from, to and result are assumed to have been size-checked by chrono::dcf.
+        */
+        constexpr void operator()(
+            std::span<const std::chrono::sys_days> from,
+            std::span<const std::chrono::sys_days> to,
+            std::span<double> result
+        ) const
+        {
+            constexpr double year_per_days = 1. / 365.;
+            for (std::size_t i = 0; i != from.size(); ++i) {
+                result[i] = (to[i] - from[i]).count() * year_per_days;
+            }
+        }
+
+        constexpr void operator()(
+            std::span<const std::chrono::sys_seconds> from,
+            std::span<const std::chrono::sys_seconds> to,
+            std::span<double> result
+        ) const
+        {
+            constexpr double secs_per_days = 1. / (365 * 60 * 60 * 24);
+            for (std::size_t i = 0; i != from.size(); ++i) {
+                result[i] = (to[i] - from[i]).count() * secs_per_days;
+            }
+        }
+
         constexpr auto operator<=>(const act365f_t&) const noexcept = default;
 
     }; // class act365f_t
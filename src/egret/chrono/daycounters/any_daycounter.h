@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <span>
 #include <typeindex>
+#include <utility>
 #include "core/utils/maybe.h"
 #include "concepts.h"
 
@@ -16,8 +20,9 @@ namespace egret::chrono {
 
         struct base {
             virtual ~base() = default;
-            virtual std::unique_ptr<const base> clone() const = 0;
+            virtual const base* copy_to(void* buffer) const noexcept = 0;
             virtual double dcf(const TimePoint& from, const TimePoint& to) const = 0;
+            virtual void dcf(std::span<const TimePoint> from, std::span<const TimePoint> to, std::span<double> result) const = 0;
             virtual std::type_index type() const noexcept = 0;
             virtual const void* pointer() const noexcept = 0;
         };
@@ -26,48 +31,104 @@ namespace egret::chrono {
         struct model final : base {
             model(C obj) noexcept(std::is_nothrow_move_constructible_v<C>): obj_(std::move(obj)) {}
 
-            std::unique_ptr<const base> clone() const { return std::make_unique<model>(obj_); }
+            const base* copy_to(void* buffer) const noexcept override
+            {
+                if constexpr (std::is_nothrow_copy_constructible_v<C>) {
+                    return ::new (buffer) model(obj_);
+                }
+                else {
+                    std::unreachable();
+                }
+            }
             double dcf(const TimePoint& from, const TimePoint& to) const override { return chrono::dcf(obj_, from, to); }
+            void dcf(std::span<const TimePoint> from, std::span<const TimePoint> to, std::span<double> result) const override
+            {
+                chrono::dcf(obj_, from, to, result);
+            }
             std::type_index type() const noexcept override { return typeid(C); }
             const void* pointer() const noexcept override { return std::addressof(obj_); }
 
             C obj_;
         };
 
+        static constexpr std::size_t buffer_size = 2 * sizeof(void*);
+
     public:
+        /**
+         * @brief whether counters of type C are held in the inline buffer rather than shared immutably.
+         * @details stateless counters such as act360 and act365f fit in the buffer.
+        */
+        template <typename C>
+        static constexpr bool is_inplace =
+            sizeof(model<C>) <= buffer_size &&
+            alignof(model<C>) <= alignof(void*) &&
+            std::is_trivially_copyable_v<C> &&
+            std::is_nothrow_copy_constructible_v<C>;
+
     // -------------------------------------------------------------------------
     //  ctors, dtor and assigns
     //
         any_daycounter() = delete;
-        any_daycounter(const this_type& other) : obj_(other.obj_->clone()) {}
-        any_daycounter(this_type&&) noexcept = default;
-        
-        template <cpt::daycounter<TimePoint> DC>
+        any_daycounter(const this_type& other) noexcept { this->assign(other); }
+        any_daycounter(this_type&& other) noexcept { this->assign(std::move(other)); }
+        ~any_daycounter() noexcept { this->reset(); }
+
+        template <typename DC>
+            requires (!std::is_same_v<std::remove_cvref_t<DC>, any_daycounter>) && cpt::daycounter<DC, TimePoint>
         any_daycounter(DC&& dc)
-            : obj_(std::make_unique<model<std::remove_cvref_t<DC>>>(std::forward<DC>(dc)))
         {
+            using model_t = model<std::remove_cvref_t<DC>>;
+            if constexpr (is_inplace<std::remove_cvref_t<DC>>) {
+                obj_ = ::new (static_cast<void*>(buffer_)) model_t(std::forward<DC>(dc));
+            }
+            else {
+                shared_ = std::make_shared<const model_t>(std::forward<DC>(dc));
+                obj_ = shared_.get();
+            }
         }
 
-        this_type& operator =(const this_type& other)
+        this_type& operator =(const this_type& other) noexcept
+        {
+            if (&other == this) {
+                return *this;
+            }
+            this->reset();
+            this->assign(other);
+            return *this;
+        }
+        this_type& operator =(this_type&& other) noexcept
         {
             if (&other == this) {
                 return *this;
             }
-            obj_ = other.obj_->clone();
+            this->reset();
+            this->assign(std::move(other));
             return *this;
         }
-        this_type& operator =(this_type&&) noexcept = default;
 
     // -------------------------------------------------------------------------
     //  daycounter behavior
     //
         double operator()(const TimePoint& from, const TimePoint& to) const { return obj_->dcf(from, to); }
 
+        /**
+         * @brief bulk version. one virtual dispatch per batch.
+        */
+        void operator()(std::span<const TimePoint> from, std::span<const TimePoint> to, std::span<double> result) const
+        {
+            obj_->dcf(from, to, result);
+        }
+
     // -------------------------------------------------------------------------
     //  get
     //
         std::type_index type() const noexcept { return obj_->type(); }
 
+        /**
+         * @brief whether the counter is held in the inline buffer. false after moved from.
+        */
+        bool is_buffered() const noexcept { return obj_ != nullptr && !shared_; }
+
         template <cpt::daycounter<TimePoint> DC>
         util::maybe<const DC&> as() const noexcept
         {
@@ -80,7 +141,36 @@ namespace egret::chrono {
         }
         
     private:
-        std::unique_ptr<const base> obj_;
+        void reset() noexcept
+        {
+            if (this->is_buffered()) {
+                obj_->~base();
+            }
+            shared_.reset();
+            obj_ = nullptr;
+        }
+
+        // copying never allocates: either a trivially copyable model or a reference count.
+        void assign(const this_type& other) noexcept
+        {
+            if (other.is_buffered()) {
+                obj_ = other.obj_->copy_to(buffer_);
+            }
+            else {
+                shared_ = other.shared_;
+                obj_ = shared_.get();
+            }
+        }
+
+        void assign(this_type&& other) noexcept
+        {
+            this->assign(std::as_const(other));
+            other.reset();
+        }
+
+        alignas(void*) std::byte buffer_[buffer_size];
+        const base* obj_ = nullptr;
+        std::shared_ptr<const base> shared_;
 
     }; // class any_daycounter
     
@@ -2,6 +2,9 @@
 
 #include <chrono>
 #include <concepts>
+#include <functional>
+#include <span>
+#include "core/assertions/assertion.h"
 
 namespace egret_detail::dcf_impl {
     void dcf(auto&&, auto&&, auto&&) = delete;
@@ -39,6 +42,34 @@ namespace egret_detail::dcf_impl {
                 return dcf(counter, from, to);
             }
         }
+
+        /**
+         * @brief result[i] = dcf(counter, from[i], to[i]).
+         * @details dispatches to counter(from, to, result) when the counter provides a bulk kernel,
+         *  otherwise falls back to the element-wise dcf.
+        */
+        template <typename C, typename TimePoint>
+            requires std::is_invocable_r_v<double, const dcf_t&, const C&, const TimePoint&, const TimePoint&>
+        constexpr void operator()(
+            const C& counter,
+            std::span<const TimePoint> from,
+            std::span<const TimePoint> to,
+            std::span<double> result
+        ) const
+        {
+            egret::assertion(
+                from.size() == to.size() && from.size() <= result.size(),
+                "Size mismatch. [from.size={}, to.size={}, result.size={}]", from.size(), to.size(), result.size()
+            );
+            if constexpr (std::is_invocable_v<const C&, std::span<const TimePoint>, std::span<const TimePoint>, std::span<double>>) {
+                std::invoke(counter, from, to, result);
+            }
+            else {
+                for (std::size_t i = 0; i != from.size(); ++i) {
+                    result[i] = (*this)(counter, from[i], to[i]);
+                }
+            }
+        }
         
     }; // class dcf_t
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <variant>
 #include <tuple>
 #include <nlohmann/json_fwd.hpp>
@@ -46,6 +47,17 @@ namespace egret::chrono {
             );
         }
 
+        /**
+         * @brief bulk version. the alternative is resolved once per batch.
+        */
+        constexpr void operator()(std::span<const TimePoint> from, std::span<const TimePoint> to, std::span<double> result) const
+        {
+            std::visit(
+                [&from, &to, &result](const auto& counter) { chrono::dcf(counter, from, to, result); },
+                static_cast<const super_type&>(*this)
+            );
+        }
+
     }; // class daycounter_variant
 
     template <typename ...TimePoints, typename ...DayCounters>
@@ -88,6 +100,21 @@ namespace egret::chrono {
             );
         }
 
+        /**
+         * @brief bulk version. the alternative is resolved once per batch.
+        */
+        template <typename TimePoint>
+            requires std::disjunction_v<std::is_same<TimePoint, TimePoints>...>
+        constexpr void operator()(std::span<const TimePoint> from, std::span<const TimePoint> to, std::span<double> result) const
+        {
+            std::visit(
+                [&from, &to, &result](const auto& counter) { 
+                    chrono::dcf(counter, from, to, result); 
+                },
+                static_cast<const super_type&>(*this)
+            );
+        }
+
     }; // class daycounter_variant
 
 } // namespace egret::chrono
@@ -0,0 +1,4 @@
+#pragma once
+
+#include "schedules/schedule.h"
+#include "schedules/tenor_grid.h"
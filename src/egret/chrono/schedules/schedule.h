@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include "core/chrono/tenor.h"
+#include "core/chrono/calendars/calendar.h"
+#include "../adjustments/holiday_adjustment.h"
+
+namespace egret::chrono {
+// -----------------------------------------------------------------------------
+//  [enum] schedule_generation
+// -----------------------------------------------------------------------------
+    /**
+     * @brief direction in which unadjusted dates are generated. stub is placed on the opposite side.
+    */
+    enum class schedule_generation : char {
+        forward,
+        backward,
+    };
+
+    constexpr auto string_value_map_of(std::type_identity<schedule_generation>)
+    {
+        using pair_t = std::pair<const char*, schedule_generation>;
+        return std::array {
+            pair_t {"forward", schedule_generation::forward},
+            pair_t {"backward", schedule_generation::backward},
+        };
+    }
+
+// -----------------------------------------------------------------------------
+//  [struct] schedule_convention
+// -----------------------------------------------------------------------------
+    struct schedule_convention {
+        chrono::tenor tenor;
+        holiday_adjustment_type accrual_adjustment = holiday_adjustment_type::modified_following;
+        holiday_adjustment_type payment_adjustment = holiday_adjustment_type::following;
+        std::int32_t payment_lag = 0;                   // businessdays after adjusted accrual end
+        std::int32_t fixing_lag = 0;                    // businessdays before adjusted accrual start
+        std::optional<std::chrono::day> roll_day;       // day of month of unadjusted intermediate dates
+        bool end_of_month = false;                      // roll to month end if the anchor date is month end
+        schedule_generation generation = schedule_generation::backward;
+
+        friend constexpr bool operator ==(const schedule_convention&, const schedule_convention&) = default;
+    };
+
+// -----------------------------------------------------------------------------
+//  [struct] schedule_period
+// -----------------------------------------------------------------------------
+    struct schedule_period {
+        std::chrono::sys_days accrual_start;
+        std::chrono::sys_days accrual_end;
+        std::chrono::sys_days payment_date;
+        std::chrono::sys_days fixing_date;
+
+        friend constexpr bool operator ==(const schedule_period&, const schedule_period&) = default;
+    };
+
+    using schedule = std::shared_ptr<const std::vector<schedule_period>>;
+
+// -----------------------------------------------------------------------------
+//  [fn] make_schedule
+// -----------------------------------------------------------------------------
+    /**
+     * @brief generate periods between start and end.
+     * @details
+     *  unadjusted dates are generated from the anchor (end for backward, start for forward) 
+     *  by multiples of the tenor, so that month-end clamping does not drift.
+     *  accrual dates are adjusted with accrual_adjustment, payment and fixing dates are 
+     *  shifted from the adjusted accrual dates by businessdays.
+    */
+    std::vector<schedule_period> make_schedule(
+        const std::chrono::sys_days& start,
+        const std::chrono::sys_days& end,
+        const schedule_convention& convention,
+        const calendar& cal
+    );
+
+// -----------------------------------------------------------------------------
+//  [class] schedule_generator
+// -----------------------------------------------------------------------------
+    /**
+     * @brief make_schedule with memo. thread-safe.
+     * @details
+     *  schedules are keyed by (convention, calendar identifier, start, end) and shared between callers.
+     *  an entry built from a calendar which is not equal to the given one (e.g. after calendar_server::reload) is rebuilt.
+     *  at most capacity entries are kept; an arbitrary entry is evicted to make room for a new one.
+    */
+    class schedule_generator {
+    private:
+        using this_type = schedule_generator;
+        struct impl;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        schedule_generator();
+        explicit schedule_generator(std::size_t capacity);
+        schedule_generator(const this_type&) noexcept = default;
+        schedule_generator(this_type&&) noexcept = default;
+
+        this_type& operator =(const this_type&) noexcept = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  generate
+    //
+        schedule operator()(
+            const std::chrono::sys_days& start,
+            const std::chrono::sys_days& end,
+            const schedule_convention& convention,
+            const calendar& cal
+        ) const;
+
+    // -------------------------------------------------------------------------
+    //  memo
+    //
+        static constexpr std::size_t default_capacity = 4096;
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+        void clear() const;
+
+    private:
+        std::shared_ptr<impl> impl_;
+
+    }; // class schedule_generator
+
+} // namespace egret::chrono
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <span>
+#include <vector>
+#include "core/chrono/tenor.h"
+#include "core/chrono/calendars/calendar.h"
+#include "../adjustments/holiday_adjustment.h"
+
+namespace egret::chrono {
+// -----------------------------------------------------------------------------
+//  [class] tenor_grid
+// -----------------------------------------------------------------------------
+    /**
+     * @brief dense (reference date x tenor) matrix of dates, stored row-major.
+    */
+    class tenor_grid {
+    private:
+        using this_type = tenor_grid;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        tenor_grid() = default;
+        tenor_grid(const this_type&) = default;
+        tenor_grid(this_type&&) noexcept = default;
+
+        /**
+         * @brief refs[i] + tenors[j] for all i, j.
+        */
+        tenor_grid(std::span<const std::chrono::sys_days> refs, std::span<const chrono::tenor> tenors);
+
+        /**
+         * @brief adjust(refs[i] + tenors[j], cal, type) for all i, j.
+        */
+        tenor_grid(
+            std::span<const std::chrono::sys_days> refs, 
+            std::span<const chrono::tenor> tenors,
+            const calendar& cal,
+            holiday_adjustment_type type
+        );
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        std::size_t rows() const noexcept { return rows_; }
+        std::size_t cols() const noexcept { return cols_; }
+
+        const std::chrono::sys_days& operator()(std::size_t i, std::size_t j) const noexcept { return dates_[i * cols_ + j]; }
+        std::span<const std::chrono::sys_days> row(std::size_t i) const noexcept 
+        { 
+            return std::span<const std::chrono::sys_days>(dates_).subspan(i * cols_, cols_); 
+        }
+        const std::vector<std::chrono::sys_days>& dates() const noexcept { return dates_; }
+
+    private:
+        std::size_t rows_ = 0;
+        std::size_t cols_ = 0;
+        std::vector<std::chrono::sys_days> dates_;
+
+    }; // class tenor_grid
+
+} // namespace egret::chrono
@@ -1,25 +1,12 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+#include "core/assertions/assertion.h"
+#include "core/chrono/civil.h"
 #include "../adjustments/holiday_adjustment.h"
 
 namespace egret_detail::hadj_impl {
-    struct is_busday_t {
-        
-        is_busday_t(const egret::chrono::calendar& cal) noexcept
-            : additional_hds(&cal.additional_holidays()), additional_bds(&cal.additional_businessdays())
-        {
-        }
-
-        const std::vector<std::chrono::sys_days>* additional_hds;
-        const std::vector<std::chrono::sys_days>* additional_bds;
-
-        bool operator()(const std::chrono::sys_days& d) const
-        {
-            const auto wd = std::chrono::weekday(d);
-            return wd != std::chrono::Saturday && wd != std::chrono::Sunday
-                ? !std::ranges::binary_search(*additional_hds, d)
-                :  std::ranges::binary_search(*additional_bds, d);
-        }
-    };
-
 // -----------------------------------------------------------------------------
 //  [fn] adjust
 // -----------------------------------------------------------------------------
@@ -29,12 +16,7 @@ namespace egret_detail::hadj_impl {
         type_constant<egret::chrono::holiday_adjustment_type::following>
     )
     {
-        const auto is_busday = is_busday_t(cal);
-        auto result = d;
-        while (!is_busday(d)) {
-            result += std::chrono::days(1);
-        }
-        return result;
+        return egret::chrono::next_businessday(cal, d);
     }
 
     std::chrono::sys_days adjust(
@@ -43,12 +25,7 @@ namespace egret_detail::hadj_impl {
         type_constant<egret::chrono::holiday_adjustment_type::preceeding>
     )
     {
-        const auto is_busday = is_busday_t(cal);
-        auto result = d;
-        while (!is_busday(d)) {
-            result -= std::chrono::days(1);
-        }
-        return result;
+        return egret::chrono::prev_businessday(cal, d);
     }
     
     std::chrono::sys_days adjust(
@@ -58,7 +35,7 @@ namespace egret_detail::hadj_impl {
     )
     {
         auto result = adjust(d, cal, type_constant<egret::chrono::holiday_adjustment_type::following> {});
-        if (std::chrono::year_month_day(d).month() != std::chrono::year_month_day(result).month()) [[unlikely]] {
+        if (egret::chrono::to_civil(d).month != egret::chrono::to_civil(result).month) [[unlikely]] {
             return adjust(
                 result -= std::chrono::days(1), cal,
                 type_constant<egret::chrono::holiday_adjustment_type::preceeding> {}
@@ -76,7 +53,7 @@ namespace egret_detail::hadj_impl {
     )
     {
         auto result = adjust(d, cal, type_constant<egret::chrono::holiday_adjustment_type::preceeding> {});
-        if (std::chrono::year_month_day(d).month() != std::chrono::year_month_day(result).month()) [[unlikely]] {
+        if (egret::chrono::to_civil(d).month != egret::chrono::to_civil(result).month) [[unlikely]] {
             return adjust(
                 result += std::chrono::days(1), cal,
                 type_constant<egret::chrono::holiday_adjustment_type::following> {}
@@ -136,4 +113,37 @@ namespace egret::chrono {
     {
         return egret_detail::hadj_impl::adjust(dt, cal, type);
     }
+
+    void adjust(
+        std::span<const std::chrono::sys_days> ds,
+        std::span<std::chrono::sys_days> result,
+        const calendar& cal,
+        holiday_adjustment_type type
+    )
+    {
+        assertion(
+            ds.size() <= result.size(),
+            "Result is too short to store adjusted dates. [dates.size={}, result.size={}]", ds.size(), result.size()
+        );
+        // ds and result may overlap, so that the copy runs away from the overlap and dates are read from result
+        if (result.data() < ds.data()) {
+            std::ranges::copy(ds, result.begin());
+        }
+        else if (ds.data() < result.data()) {
+            std::ranges::copy_backward(ds, result.begin() + static_cast<std::ptrdiff_t>(ds.size()));
+        }
+        if (type == holiday_adjustment_type::unadjust || ds.empty()) {
+            return;
+        }
+
+        const auto dates = result.first(ds.size());
+        auto mask = std::vector<std::uint64_t>((dates.size() + 63) / 64);
+        cal.is_holiday(std::span<const std::chrono::sys_days>(dates), mask);
+        for (std::size_t w = 0; w != mask.size(); ++w) {
+            for (auto word = mask[w]; word != 0; word &= word - 1) {
+                const auto i = w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+                result[i] = egret_detail::hadj_impl::adjust(result[i], cal, type);
+            }
+        }
+    }
 } // namespace egret::chrono
\ No newline at end of file
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include "core/assertions/assertion.h"
+#include "core/chrono/civil.h"
+#include "../adjustments/add_tenor.h"
+#include "../adjustments/eom.h"
+#include "../adjustments/roll.h"
+#include "../schedules/schedule.h"
+
+namespace egret::chrono {
+    namespace {
+        bool _is_month_end(const civil_date& c) noexcept
+        {
+            return c.day == last_day_of_month(c.year, c.month);
+        }
+
+        // add count tenors to the anchor. month based tenors clamp the day to the month end.
+        std::chrono::sys_days _shift(
+            const civil_date& anchor, 
+            const tenor& tnr, 
+            std::int32_t count, 
+            const schedule_convention& convention,
+            bool anchor_is_month_end
+        )
+        {
+            if (tnr.unit() == tenor_unit::days || tnr.unit() == tenor_unit::weeks) {
+                return add_tenor(tnr * count)(from_civil(anchor));
+            }
+            // shift the first of the month not to overflow, then move to the month end or the roll day
+            const auto first = add_tenor(tnr * count)(from_civil(anchor.year, anchor.month, 1));
+            if (convention.end_of_month && anchor_is_month_end) {
+                return eom()(first);
+            }
+            return roll(convention.roll_day.value_or(std::chrono::day(anchor.day)), true)(first);
+        }
+
+        // unadjusted period boundaries in ascending order, including start and end
+        std::vector<std::chrono::sys_days> _unadjusted_dates(
+            const std::chrono::sys_days& start,
+            const std::chrono::sys_days& end,
+            const schedule_convention& convention
+        )
+        {
+            const auto& tnr = convention.tenor;
+            assertion(tnr.count() > 0, "Schedule tenor must be positive. [tenor={}]", tnr);
+
+            auto result = std::vector<std::chrono::sys_days> {start};
+            if (convention.generation == schedule_generation::forward) {
+                const auto anchor = to_civil(start);
+                const bool eom = _is_month_end(anchor);
+                for (std::int32_t k = 1; ; ++k) {
+                    const auto d = _shift(anchor, tnr, k, convention, eom);
+                    if (d >= end) {
+                        break;
+                    }
+                    result.push_back(d);
+                }
+                result.push_back(end);
+            }
+            else {
+                const auto anchor = to_civil(end);
+                const bool eom = _is_month_end(anchor);
+                auto reversed = std::vector<std::chrono::sys_days> {end};
+                for (std::int32_t k = 1; ; ++k) {
+                    const auto d = _shift(anchor, tnr, -k, convention, eom);
+                    if (d <= start) {
+                        break;
+                    }
+                    reversed.push_back(d);
+                }
+                result.insert(result.end(), reversed.rbegin(), reversed.rend());
+            }
+            return result;
+        }
+
+    } // namespace 
+
+// -----------------------------------------------------------------------------
+//  [fn] make_schedule
+// -----------------------------------------------------------------------------
+    std::vector<schedule_period> make_schedule(
+        const std::chrono::sys_days& start,
+        const std::chrono::sys_days& end,
+        const schedule_convention& convention,
+        const calendar& cal
+    )
+    {
+        assertion(start < end, "Schedule start must be before end. [start={}, end={}]", start, end);
+
+        auto dates = _unadjusted_dates(start, end, convention);
+        chrono::adjust(dates, dates, cal, convention.accrual_adjustment);
+
+        auto result = std::vector<schedule_period>();
+        result.reserve(dates.size() - 1);
+        for (std::size_t i = 1; i < dates.size(); ++i) {
+            // adjustment may collapse a short stub into its neighbor
+            if (dates[i - 1] >= dates[i]) {
+                continue;
+            }
+            result.push_back({
+                .accrual_start = dates[i - 1],
+                .accrual_end = dates[i],
+                .payment_date = add_businessdays(cal, chrono::adjust(dates[i], cal, convention.payment_adjustment), convention.payment_lag),
+                .fixing_date = add_businessdays(cal, dates[i - 1], -convention.fixing_lag),
+            });
+        }
+        return result;
+    }
+
+// -----------------------------------------------------------------------------
+//  [class] schedule_generator
+// -----------------------------------------------------------------------------
+    struct schedule_generator::impl {
+        struct key_type {
+            schedule_convention convention;
+            calendar_identifier calendar_id;
+            std::chrono::sys_days start;
+            std::chrono::sys_days end;
+
+            friend bool operator ==(const key_type&, const key_type&) = default;
+        };
+
+        struct hasher {
+            std::size_t operator()(const key_type& key) const noexcept
+            {
+                const auto& c = key.convention;
+                // combined in 64 bits and narrowed once, so that the constant does not truncate on 32-bit targets
+                std::uint64_t h = std::hash<calendar_identifier>()(key.calendar_id);
+                const auto combine = [&h](std::uint64_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+                combine(std::hash<std::int64_t>()(key.start.time_since_epoch().count()));
+                combine(std::hash<std::int64_t>()(key.end.time_since_epoch().count()));
+                combine(std::hash<std::int32_t>()(c.tenor.count()));
+                combine(static_cast<std::size_t>(c.tenor.unit()));
+                combine(static_cast<std::size_t>(c.accrual_adjustment));
+                combine(static_cast<std::size_t>(c.payment_adjustment));
+                combine(std::hash<std::int32_t>()(c.payment_lag));
+                combine(std::hash<std::int32_t>()(c.fixing_lag));
+                combine(c.roll_day ? static_cast<unsigned>(*c.roll_day) : 0u);
+                combine(static_cast<std::size_t>(c.end_of_month));
+                combine(static_cast<std::size_t>(c.generation));
+                return static_cast<std::size_t>(h);
+            }
+        };
+
+        struct entry {
+            calendar cal;
+            schedule periods;
+        };
+
+        std::size_t capacity;
+        std::unordered_map<key_type, entry, hasher> memo;
+        std::mutex mutex;
+    };
+
+    schedule_generator::schedule_generator()
+        : schedule_generator(default_capacity)
+    {
+    }
+
+    schedule_generator::schedule_generator(std::size_t capacity)
+        : impl_(std::make_shared<impl>(capacity))
+    {
+        assertion(capacity > 0, "Schedule generator capacity must be positive.");
+    }
+
+    schedule schedule_generator::operator()(
+        const std::chrono::sys_days& start,
+        const std::chrono::sys_days& end,
+        const schedule_convention& convention,
+        const calendar& cal
+    ) const
+    {
+        auto key = impl::key_type {convention, cal.identifier(), start, end};
+        {
+            const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+            if (const auto it = impl_->memo.find(key); it != impl_->memo.end() && it->second.cal == cal) {
+                return it->second.periods;
+            }
+        }
+
+        // generate without lock. the first registered one wins.
+        auto periods = std::make_shared<const std::vector<schedule_period>>(make_schedule(start, end, convention, cal));
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        if (impl_->memo.size() >= impl_->capacity && !impl_->memo.contains(key)) {
+            // evict an arbitrary entry. callers keep their shared schedules alive
+            impl_->memo.erase(impl_->memo.begin());
+        }
+        auto [it, inserted] = impl_->memo.try_emplace(std::move(key), impl::entry {cal, periods});
+        if (!inserted && it->second.cal != cal) {
+            it->second = impl::entry {cal, std::move(periods)};
+        }
+        return it->second.periods;
+    }
+
+    std::size_t schedule_generator::size() const
+    {
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        return impl_->memo.size();
+    }
+
+    std::size_t schedule_generator::capacity() const
+    {
+        return impl_->capacity;
+    }
+
+    void schedule_generator::clear() const
+    {
+        const auto _ = std::lock_guard<std::mutex>(impl_->mutex);
+        impl_->memo.clear();
+    }
+
+} // namespace egret::chrono
@@ -0,0 +1,24 @@
+#include "../schedules/tenor_grid.h"
+
+namespace egret::chrono {
+// -----------------------------------------------------------------------------
+//  [class] tenor_grid
+// -----------------------------------------------------------------------------
+    tenor_grid::tenor_grid(std::span<const std::chrono::sys_days> refs, std::span<const chrono::tenor> tenors)
+        : rows_(refs.size()), cols_(tenors.size()), dates_(refs.size() * tenors.size())
+    {
+        chrono::add_tenors(refs, tenors, dates_);
+    }
+
+    tenor_grid::tenor_grid(
+        std::span<const std::chrono::sys_days> refs, 
+        std::span<const chrono::tenor> tenors,
+        const calendar& cal,
+        holiday_adjustment_type type
+    )
+        : tenor_grid(refs, tenors)
+    {
+        chrono::adjust(dates_, dates_, cal, type);
+    }
+
+} // namespace egret::chrono
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <span>
+#include <vector>
+#include <ranges>
+#include <algorithm>
+#include "core/assertions/assertion.h"
+#include "core/assertions/exception.h"
+#include "core/chrono/stopwatch.h"
+#include "core/math/autodiff/dual.h"
+#include "core/math/solver/newton1d.h"
+#include "core/math/solver/newton_nd.h"
+#include "constraints/concepts.h"
+#include "constraints/curve_layout.h"
+
+namespace egret::fit::yc {
+// -----------------------------------------------------------------------------
+//  [struct] bootstrap_config
+// -----------------------------------------------------------------------------
+    struct bootstrap_config {
+        double parameter_tolerance = 1e-12; // step size to stop newton iterations
+        double residual_tolerance = 1e-8;   // max |residual| accepted after the sequential stage
+        double bump = 1e-7;                 // finite difference step of derivatives
+        std::size_t max_iter = 100;
+        bool global_fallback = true;
+    };
+
+// -----------------------------------------------------------------------------
+//  [enum] bootstrap_stage
+//  [struct] bootstrap_stage_log
+//  [struct] bootstrap_result
+// -----------------------------------------------------------------------------
+    enum class bootstrap_stage {
+        sequential,
+        global,
+    };
+
+    struct bootstrap_stage_log {
+        bootstrap_stage stage;
+        std::size_t pillar;         // solved pillar for sequential stages, the number of pillars for the global stage
+        std::size_t iterations;
+        double residual;            // |residual| of the pillar, or max |residual| for the global stage
+        std::chrono::microseconds elapsed;
+    };
+
+    struct bootstrap_result {
+        std::vector<double> parameters;
+        std::vector<double> residuals;
+        std::vector<bootstrap_stage_log> stages;
+    };
+
+} // namespace egret::fit::yc
+
+namespace egret::cpt {
+// -----------------------------------------------------------------------------
+//  [concept] curve_parametrization
+// -----------------------------------------------------------------------------
+    template <typename P>
+    concept curve_parametrization = requires (const P& p, std::span<const double> params, std::size_t k) {
+        { p.size() } -> std::convertible_to<std::size_t>;
+        { p.segment_end(k) } -> std::convertible_to<std::size_t>;
+        p.build(params);
+    };
+
+} // namespace egret::cpt
+
+namespace egret_detail::bootstrap_impl {
+    template <typename P>
+    using curves_t = decltype(std::declval<const P&>().build(std::declval<std::span<const double>>()));
+
+    template <typename P>
+    using tag_t = typename curves_t<P>::key_type;
+
+    // constraints bound to curve slots are preferred, so that tags are not looked up on each evaluation.
+    template <typename C, typename RateTag, typename Curve>
+        requires
+            requires (const C& c, const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves) { egret::fit::yc::evaluate(c, vdt, curves); } ||
+            requires (const C& c, const std::chrono::sys_days& vdt, std::span<const Curve> slots) { egret::fit::yc::evaluate(c, vdt, slots); }
+    auto evaluate_on(const C& constraint, const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves, std::span<const Curve> slots)
+    {
+        namespace yc = egret::fit::yc;
+        if constexpr (requires { yc::evaluate(constraint, vdt, slots); }) {
+            return yc::evaluate(constraint, vdt, slots);
+        }
+        else {
+            return yc::evaluate(constraint, vdt, curves);
+        }
+    }
+
+    template <typename C, typename RateTag, typename Curve>
+    double residual(const C& constraint, const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves, std::span<const Curve> slots)
+    {
+        return static_cast<double>(evaluate_on(constraint, vdt, curves, slots));
+    }
+
+    using dual_t = egret::math::autodiff::dual<double>;
+    using dual1_t = egret::math::autodiff::dual<double, 1>;
+
+    template <typename P, typename D = dual_t>
+    using dual_curves_t = decltype(std::declval<const P&>().build(std::declval<std::span<const D>>()));
+
+    // derivatives are computed in one pass of forward mode ad if curves are built from dual parameters
+    // and constraints are evaluated on them.
+    template <typename P, typename C, typename D = dual_t>
+    concept ad_differentiable =
+        requires (const P& p, std::span<const D> params) { p.build(params); } &&
+        requires (
+            const C& c, const std::chrono::sys_days& vdt,
+            const dual_curves_t<P, D>& curves, std::span<const typename dual_curves_t<P, D>::mapped_type> slots
+        ) {
+            { evaluate_on(c, vdt, curves, slots) } -> std::same_as<D>;
+        };
+
+} // namespace egret_detail::bootstrap_impl
+
+namespace egret::fit::yc {
+// -----------------------------------------------------------------------------
+//  [fn] bootstrap
+// -----------------------------------------------------------------------------
+    /**
+     * @brief solves parameters of curves so that every constraint evaluates to zero.
+     * @details
+     *  constraints[k] is paired with the k-th parameter, so they must be ordered as pillars of parametrization.
+     *  constraints bound to curve slots (see bind) are evaluated on curves arranged by layout, which must consist of
+     *  the tags of curves built by parametrization.
+     *  sequential stage: each pillar is solved by newton_raphson1d with earlier pillars fixed, and later pillars
+     *      of the same curve moved together (flat extrapolation).
+     *  global stage: when some residual still exceeds residual_tolerance, e.g. for non-local interpolants or
+     *      curves coupled out of order, all parameters are solved at once by newton iterations warm started
+     *      from the sequential result.
+     *  derivatives are computed by forward mode automatic differentiation if the parametrization builds curves
+     *  from dual parameters and constraints can be evaluated on them, and by forward differences otherwise.
+     *  curves are then built once per newton step of the sequential stage.
+     * @param initial initial parameters. zeros if empty.
+    */
+    template <cpt::curve_parametrization Parametrization, std::ranges::random_access_range Constraints>
+    bootstrap_result bootstrap(
+        const Parametrization& parametrization,
+        const Constraints& constraints,
+        const curve_layout<egret_detail::bootstrap_impl::tag_t<Parametrization>>& layout,
+        const std::chrono::sys_days& vdt,
+        const bootstrap_config& config = {},
+        std::vector<double> initial = {}
+    )
+    {
+        namespace impl = egret_detail::bootstrap_impl;
+        using constraint_t = std::ranges::range_value_t<const Constraints&>;
+        const std::size_t n = parametrization.size();
+        if (static_cast<std::size_t>(std::ranges::size(constraints)) != n) {
+            throw exception(
+                "The number of constraints must agree with the number of parameters. [constraints={}, parameters={}]",
+                std::ranges::size(constraints), n
+            ).record_stacktrace();
+        }
+        auto x = initial.empty() ? std::vector<double>(n, 0.) : std::move(initial);
+        if (x.size() != n) {
+            throw exception("Initial parameter size mismatch. [expected={}, actual={}]", n, x.size()).record_stacktrace();
+        }
+        {
+            const auto curves = parametrization.build(std::span<const double>(x));
+            egret::assertion(
+                std::ranges::equal(layout.tags(), curves | std::views::keys),
+                "Curve layout does not agree with curves of the parametrization. [layout={}, curves={}]",
+                layout.size(), curves.size()
+            );
+        }
+
+        const auto residual_at = [&parametrization, &constraints, &layout, &vdt](std::size_t k, const std::vector<double>& params) {
+            const auto curves = parametrization.build(std::span<const double>(params));
+            const auto slots = layout.arrange(curves);
+            return impl::residual(std::ranges::begin(constraints)[k], vdt, curves, std::span(slots));
+        };
+        const auto residuals_at = [&parametrization, &constraints, &layout, &vdt](const std::vector<double>& params) {
+            const auto curves = parametrization.build(std::span<const double>(params));
+            const auto slots = layout.arrange(curves);
+            auto result = std::vector<double> {};
+            result.reserve(params.size());
+            for (const auto& c : constraints) {
+                result.push_back(impl::residual(c, vdt, curves, std::span(slots)));
+            }
+            return result;
+        };
+        const auto max_abs = [](const std::vector<double>& rs) {
+            double result = 0.;
+            for (const double r : rs) {
+                result = std::max(result, std::abs(r));
+            }
+            return result;
+        };
+
+        bootstrap_result result;
+        bool sequential_failed = false;
+
+        // sequential stage
+        for (std::size_t k = 0; k != n && !sequential_failed; ++k) {
+            auto sw = chrono::stopwatch {};
+            sw.start();
+            const std::size_t last = parametrization.segment_end(k);
+            auto trial = x;
+            const auto assign = [&trial, k, last](double v) { std::fill(trial.begin() + k, trial.begin() + last, v); };
+            const auto f = [&](const double& v) -> std::pair<double, double> {
+                if constexpr (impl::ad_differentiable<Parametrization, constraint_t, impl::dual1_t>) {
+                    // parameters of the pillar and the later pillars of the curve are a single variable
+                    auto params = std::vector<impl::dual1_t>(trial.begin(), trial.end());
+                    std::fill(params.begin() + k, params.begin() + last, impl::dual1_t::variable(v, 0));
+                    const auto curves = parametrization.build(std::span<const impl::dual1_t>(params));
+                    const auto slots = layout.arrange(curves);
+                    const impl::dual1_t r = impl::evaluate_on(std::ranges::begin(constraints)[k], vdt, curves, std::span(slots));
+                    return {r.value(), r.derivative(0)};
+                }
+                else {
+                    assign(v);
+                    const double r = residual_at(k, trial);
+                    assign(v + config.bump);
+                    const double rb = residual_at(k, trial);
+                    return {r, (rb - r) / config.bump};
+                }
+            };
+            const auto tolerance = [&config](const double& prev, const double& cur) {
+                return std::abs(cur - prev) <= config.parameter_tolerance;
+            };
+            const auto solved = math::solver::newton_raphson1d(f, tolerance, x[k], config.max_iter);
+            sw.stop();
+
+            if (!solved.result()) {
+                if (!config.global_fallback) {
+                    throw solved.result().error();
+                }
+                sequential_failed = true;
+                break;
+            }
+            assign(*solved.result());
+            x = std::move(trial);
+            result.stages.push_back({
+                .stage = bootstrap_stage::sequential,
+                .pillar = k,
+                .iterations = solved.log().size(),
+                .residual = std::abs(residual_at(k, x)),
+                .elapsed = sw.microseconds()
+            });
+        }
+
+        // global stage
+        auto rs = residuals_at(x);
+        if (sequential_failed || max_abs(rs) > config.residual_tolerance) {
+            if (!config.global_fallback) {
+                throw exception("Bootstrap does not converge. [max_residual={}]", max_abs(rs)).record_stacktrace();
+            }
+            auto sw = chrono::stopwatch {};
+            sw.start();
+            const auto residual = [&residuals_at](std::span<const double> params, std::span<double> r) {
+                std::ranges::copy(residuals_at(std::vector<double>(params.begin(), params.end())), r.begin());
+            };
+            const auto jacobian = [&](std::span<const double> params, math::solver::jacobian_matrix<double>& jac) {
+                if constexpr (impl::ad_differentiable<Parametrization, constraint_t>) {
+                    const auto vars = math::autodiff::variables(params);
+                    const auto curves = parametrization.build(std::span<const impl::dual_t>(vars));
+                    const auto slots = layout.arrange(curves);
+                    for (std::size_t i = 0; i != n; ++i) {
+                        const impl::dual_t r = impl::evaluate_on(std::ranges::begin(constraints)[i], vdt, curves, std::span(slots));
+                        for (std::size_t j = 0; j != n; ++j) {
+                            jac(i, j) = r.derivative(j);
+                        }
+                    }
+                }
+                else {
+                    auto bumped = std::vector<double>(params.begin(), params.end());
+                    const auto base = residuals_at(bumped);
+                    for (std::size_t j = 0; j != n; ++j) {
+                        bumped[j] += config.bump;
+                        const auto rs = residuals_at(bumped);
+                        bumped[j] = params[j];
+                        for (std::size_t i = 0; i != n; ++i) {
+                            jac(i, j) = (rs[i] - base[i]) / config.bump;
+                        }
+                    }
+                }
+            };
+            const auto solver_config = math::solver::nd_solver_config {
+                .residual_tolerance = config.residual_tolerance,
+                .step_tolerance = config.parameter_tolerance,
+                .max_iter = config.max_iter
+            };
+            const auto solved = math::solver::newton_nd(residual, jacobian, x, solver_config);
+            sw.stop();
+            if (!solved.result()) {
+                throw solved.result().error();
+            }
+            x = *solved.result();
+            rs = residuals_at(x);
+            result.stages.push_back({
+                .stage = bootstrap_stage::global,
+                .pillar = n,
+                .iterations = solved.log().size(),
+                .residual = max_abs(rs),
+                .elapsed = sw.microseconds()
+            });
+            if (max_abs(rs) > config.residual_tolerance) {
+                throw exception("Bootstrap does not converge. [max_residual={}]", max_abs(rs)).record_stacktrace();
+            }
+        }
+
+        result.parameters = std::move(x);
+        result.residuals = std::move(rs);
+        return result;
+    }
+
+    /**
+     * @brief bootstrap with the curve_layout of all curves of parametrization.
+    */
+    template <cpt::curve_parametrization Parametrization, std::ranges::random_access_range Constraints>
+    bootstrap_result bootstrap(
+        const Parametrization& parametrization,
+        const Constraints& constraints,
+        const std::chrono::sys_days& vdt,
+        const bootstrap_config& config = {},
+        std::vector<double> initial = {}
+    )
+    {
+        using tag_t = egret_detail::bootstrap_impl::tag_t<Parametrization>;
+        const auto layout = [&parametrization] {
+            if constexpr (requires { curve_layout<tag_t>(parametrization.pillars()); }) {
+                return curve_layout<tag_t>(parametrization.pillars());
+            }
+            else {
+                const auto zeros = std::vector<double>(parametrization.size(), 0.);
+                return curve_layout<tag_t>(parametrization.build(std::span<const double>(zeros)));
+            }
+        }();
+        return yc::bootstrap(parametrization, constraints, layout, vdt, config, std::move(initial));
+    }
+
+} // namespace egret::fit::yc
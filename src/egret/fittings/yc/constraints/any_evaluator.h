@@ -2,12 +2,92 @@
 
 #include <map>
 #include <memory>
+#include <span>
+#include <typeindex>
+#include "core/assertions/exception.h"
 #include "core/utils/maybe.h"
 #include "egret/models/curves/concepts.h"
 #include "egret/models/curves/any_yield_curve.h"
 #include "concepts.h"
 
 namespace egret::fit::yc {
+// -----------------------------------------------------------------------------
+//  [class] any_bound_evaluator
+// -----------------------------------------------------------------------------
+    /**
+     * @brief type erased evaluator bound to a curve_layout. see bind.
+    */
+    template <typename R, cpt::yield_curve_r<R> Curve = model::any_yield_curve<R>>
+    class any_bound_evaluator {
+    private:
+        using this_type = any_bound_evaluator;
+
+        struct base {
+            virtual ~base() = default;
+            virtual R apply(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const = 0;
+            virtual std::type_index type() const noexcept = 0;
+            virtual const void* pointer() const noexcept = 0;
+        };
+
+        template <typename C>
+        struct concrete final : base {
+            concrete(const C& obj) : obj_(obj) {}
+            concrete(C&& obj) : obj_(std::move(obj)) {}
+
+            R apply(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const override { return yc::evaluate(obj_, vdt, curves); }
+            std::type_index type() const noexcept override { return typeid(C); }
+            const void* pointer() const noexcept override { return std::addressof(obj_);  }
+
+            C obj_;
+        };
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        any_bound_evaluator() = delete;
+        any_bound_evaluator(const this_type&) noexcept = default;
+        any_bound_evaluator(this_type&&) noexcept = default;
+
+        template <typename C>
+            requires 
+                (!std::is_same_v<std::remove_cvref_t<C>, any_bound_evaluator>) &&
+                cpt::bound_yield_curve_evaluator<std::remove_cvref_t<C>, Curve> &&
+                std::convertible_to<bound_evaluate_result_t<std::remove_cvref_t<C>, Curve>, R>
+        any_bound_evaluator(C&& obj)
+            : obj_(std::make_shared<concrete<std::remove_cvref_t<C>>>(std::forward<C>(obj)))
+        {
+        }
+
+        this_type& operator =(const this_type&) noexcept = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  yield_curve_evaluator behavior
+    //
+        R evaluate(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const { return obj_->apply(vdt, curves); }
+
+    // -------------------------------------------------------------------------
+    //  type_erasure behavior
+    //
+        std::type_index type() const noexcept { return obj_->type(); }
+
+        template <typename C>
+        util::maybe<const C&> as() const noexcept
+        {
+            if (this->type() == typeid(C)) {
+                return util::maybe<const C&>(*reinterpret_cast<const C*>(obj_->pointer()));
+            }
+            else {
+                return util::maybe<const C&>();
+            }
+        }
+
+    private:
+        std::shared_ptr<const base> obj_;
+
+    }; // class any_bound_evaluator
+
 // -----------------------------------------------------------------------------
 //  [class] any_evaluator
 // -----------------------------------------------------------------------------
@@ -19,6 +99,7 @@ namespace egret::fit::yc {
         struct base {
             virtual ~base() = default;
             virtual R apply(const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves) const = 0;
+            virtual any_bound_evaluator<R, Curve> bind(const curve_layout<RateTag>& layout) const = 0;
             virtual std::type_index type() const noexcept = 0;
             virtual const void* pointer() const noexcept = 0;
         };
@@ -29,6 +110,16 @@ namespace egret::fit::yc {
             concrete(C&& obj) : obj_(std::move(obj)) {}
 
             R apply(const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves) const override { return yc::evaluate(obj_, vdt, curves); }
+            any_bound_evaluator<R, Curve> bind(const curve_layout<RateTag>& layout) const override
+            {
+                if constexpr (cpt::bindable_evaluator<C, RateTag>) {
+                    return yc::bind(obj_, layout);
+                }
+                else {
+                    throw exception("The evaluator cannot be bound to curve slots. [type='{}']", typeid(C).name())
+                        .record_stacktrace();
+                }
+            }
             std::type_index type() const noexcept override { return typeid(C); }
             const void* pointer() const noexcept override { return std::addressof(obj_);  }
 
@@ -57,6 +148,11 @@ namespace egret::fit::yc {
     //
         R evaluate(const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves) const { return obj_->apply(vdt, curves); }
 
+    // -------------------------------------------------------------------------
+    //  bind
+    //
+        any_bound_evaluator<R, Curve> bind(const curve_layout<RateTag>& layout) const { return obj_->bind(layout); }
+
     // -------------------------------------------------------------------------
     //  type_erasure behavior
     //
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <nlohmann/json_fwd.hpp>
 #include "core/utils/json_utils/j2obj.h"
 #include "egret/models/curves/concepts.h"
@@ -35,6 +36,7 @@ namespace egret::fit::yc {
         {
             using result_t = std::invoke_result_t<
                 const cashflow_evaluator<Header, Cashflow>&,
+                const Header&, const Cashflow&,
                 const std::chrono::sys_days&,
                 const std::map<RateTag, Curve>&
             >;
@@ -45,6 +47,51 @@ namespace egret::fit::yc {
             }
             return result;
         }
+
+        template <cpt::yield_curve Curve>
+            requires std::invocable<
+                const cashflow_evaluator<Header, Cashflow>&,
+                const Header&, const Cashflow&,
+                const std::chrono::sys_days&,
+                std::span<const Curve>
+            >
+        auto operator()(const inst::cfs::leg<Header, Cashflow>& leg, const std::chrono::sys_days& vdt, std::span<const Curve> curves) const
+            -> std::invoke_result_t<
+                const cashflow_evaluator<Header, Cashflow>&,
+                const Header&, const Cashflow&,
+                const std::chrono::sys_days&,
+                std::span<const Curve>
+            >
+        {
+            using result_t = std::invoke_result_t<
+                const cashflow_evaluator<Header, Cashflow>&,
+                const Header&, const Cashflow&,
+                const std::chrono::sys_days&,
+                std::span<const Curve>
+            >;
+            constexpr auto evaluator = cashflow_evaluator<Header, Cashflow> {};
+            result_t result = 0;
+            for (const auto& cf : leg.cashflows()) {
+                result += evaluator(leg.header(), cf, vdt, curves);
+            }
+            return result;
+        }
+    };
+
+// -----------------------------------------------------------------------------
+//  [struct] specializable_binder<inst::cfs::leg<Header, Cashflow>>
+// -----------------------------------------------------------------------------
+    template <typename Header, typename Cashflow>
+    struct specializable_binder<inst::cfs::leg<Header, Cashflow>> {
+        template <typename RateTag>
+            requires requires (const Header& header, const curve_layout<RateTag>& layout) {
+                specializable_binder<Header>{}(header, layout);
+            }
+        auto operator()(const inst::cfs::leg<Header, Cashflow>& leg, const curve_layout<RateTag>& layout) const
+        {
+            auto header = specializable_binder<Header>{}(leg.header(), layout);
+            return inst::cfs::leg<decltype(header), Cashflow>(std::move(header), leg.cashflows());
+        }
     };
 
 } // namespace egret::fit::yc
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 #include <nlohmann/json_fwd.hpp>
 #include "core/utils/json_utils/j2obj.h"
@@ -46,6 +47,34 @@ namespace egret::fit::yc {
             return result;
         }
 
+        template <cpt::yield_curve Curve>
+            requires cpt::bound_yield_curve_evaluator<Component, Curve>
+        auto evaluate(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const
+        {
+            using result_t = bound_evaluate_result_t<Component, Curve>;
+            result_t result {0};
+            for (const auto& comp : comps_) {
+                result += yc::evaluate(comp, vdt, curves);
+            }
+            return result;
+        }
+
+    // -------------------------------------------------------------------------
+    //  bind
+    //
+        template <typename RateTag>
+            requires cpt::bindable_evaluator<Component, RateTag>
+        auto bind(const curve_layout<RateTag>& layout) const
+            -> composite_evaluator<bind_result_t<Component, RateTag>>
+        {
+            auto comps = std::vector<bind_result_t<Component, RateTag>> {};
+            comps.reserve(comps_.size());
+            for (const auto& comp : comps_) {
+                comps.push_back(yc::bind(comp, layout));
+            }
+            return composite_evaluator<bind_result_t<Component, RateTag>>(std::move(comps));
+        }
+
     // -------------------------------------------------------------------------
     //  get
     //
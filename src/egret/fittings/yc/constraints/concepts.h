@@ -1,9 +1,11 @@
 #pragma once
 
 #include <map>
+#include <span>
 #include "core/concepts/non_void.h"
 #include "egret/models/curves/concepts.h"
 #include "egret/models/curves/any_yield_curve.h"
+#include "curve_layout.h"
 
 namespace egret::fit::yc {
 // -----------------------------------------------------------------------------
@@ -13,6 +15,13 @@ namespace egret::fit::yc {
     struct specializable_evaluator {
     };
 
+// -----------------------------------------------------------------------------
+//  [struct] specializable_binder
+// -----------------------------------------------------------------------------
+    template <typename T>
+    struct specializable_binder {
+    };
+
 } // namespace egret::fit::yc
 
 namespace egret_detail::ycc_impl {
@@ -50,7 +59,56 @@ namespace egret_detail::ycc_impl {
             }
         }
 
+        /**
+         * @brief evaluates a bound evaluator (see bind) over curves arranged by its curve_layout.
+        */
+        template <typename T, egret::cpt::yield_curve Curve>
+            requires 
+                requires (const T& evaluator, const std::chrono::sys_days& vdt, std::span<const Curve> curves) {
+                    { egret::fit::yc::specializable_evaluator<T>{}(evaluator, vdt, curves) } -> egret::cpt::non_void;
+                } ||
+                requires (const T& evaluator, const std::chrono::sys_days& vdt, std::span<const Curve> curves) {
+                    { evaluator.evaluate(vdt, curves) } -> egret::cpt::non_void;
+                }
+        auto operator()(const T& evaluator, const std::chrono::sys_days& vdt, std::span<const Curve> curves) const
+        {
+            constexpr bool has_specialization = requires (const T& e, const std::chrono::sys_days& v, std::span<const Curve> c) {
+                { egret::fit::yc::specializable_evaluator<T>{}(e, v, c) } -> egret::cpt::non_void;
+            };
+            if constexpr (has_specialization) {
+                return egret::fit::yc::specializable_evaluator<T>{}(evaluator, vdt, curves);
+            }
+            else {
+                return evaluator.evaluate(vdt, curves);
+            }
+        }
+
     }; // class evaluate_t
+
+    class bind_t {
+    public:
+        template <typename T, typename RateTag>
+            requires
+                requires (const T& evaluator, const egret::fit::yc::curve_layout<RateTag>& layout) {
+                    egret::fit::yc::specializable_binder<T>{}(evaluator, layout);
+                } ||
+                requires (const T& evaluator, const egret::fit::yc::curve_layout<RateTag>& layout) {
+                    evaluator.bind(layout);
+                }
+        auto operator()(const T& evaluator, const egret::fit::yc::curve_layout<RateTag>& layout) const
+        {
+            constexpr bool has_specialization = requires (const T& e, const egret::fit::yc::curve_layout<RateTag>& l) {
+                egret::fit::yc::specializable_binder<T>{}(e, l);
+            };
+            if constexpr (has_specialization) {
+                return egret::fit::yc::specializable_binder<T>{}(evaluator, layout);
+            }
+            else {
+                return evaluator.bind(layout);
+            }
+        }
+
+    }; // class bind_t
     
 } // namespace egret_detail::ycc_impl
 
@@ -60,6 +118,16 @@ namespace egret::fit::yc::inline cpo {
 // -----------------------------------------------------------------------------
     inline constexpr auto evaluate = egret_detail::ycc_impl::evaluate_t {};
 
+// -----------------------------------------------------------------------------
+//  [cpo] bind
+// -----------------------------------------------------------------------------
+    /**
+     * @brief resolves curve tags of an evaluator to slots of the layout.
+     * @details "curve not found" errors are raised here, so that evaluating the result over a flat array
+     *  of curves involves no tag lookups.
+    */
+    inline constexpr auto bind = egret_detail::ycc_impl::bind_t {};
+
 } // namespace egret::fit::yc::inline cpo
 
 namespace egret::cpt {
@@ -83,6 +151,23 @@ namespace egret::cpt {
             { fit::yc::evaluate(evaluator, vdt, curves) } -> std::convertible_to<R>;
         };
 
+// -----------------------------------------------------------------------------
+//  [concept] bound_yield_curve_evaluator
+//  [concept] bindable_evaluator
+// -----------------------------------------------------------------------------
+    template <typename T, typename Curve>
+    concept bound_yield_curve_evaluator =
+        cpt::yield_curve<Curve> &&
+        requires (const T& evaluator, const std::chrono::sys_days& vdt, std::span<const Curve> curves) {
+            { fit::yc::evaluate(evaluator, vdt, curves) } -> cpt::non_void;
+        };
+
+    template <typename T, typename RateTag>
+    concept bindable_evaluator =
+        requires (const T& evaluator, const fit::yc::curve_layout<RateTag>& layout) {
+            fit::yc::bind(evaluator, layout);
+        };
+
 } // namespace egret::cpt
 
 namespace egret::fit::yc {
@@ -97,4 +182,20 @@ namespace egret::fit::yc {
         std::declval<const std::map<RateTag, Curve>&>()
     ));
 
+// -----------------------------------------------------------------------------
+//  [type] bind_result_t
+//  [type] bound_evaluate_result_t
+// -----------------------------------------------------------------------------
+    template <typename T, typename RateTag>
+        requires cpt::bindable_evaluator<T, RateTag>
+    using bind_result_t = decltype(bind(std::declval<const T&>(), std::declval<const curve_layout<RateTag>&>()));
+
+    template <typename T, typename Curve>
+        requires cpt::bound_yield_curve_evaluator<T, Curve>
+    using bound_evaluate_result_t = decltype(evaluate(
+        std::declval<const T&>(),
+        std::chrono::sys_days {},
+        std::declval<std::span<const Curve>>()
+    ));
+
 } // namespace egret::fit::yc
\ No newline at end of file
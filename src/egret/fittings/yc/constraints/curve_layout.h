@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <format>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "core/assertions/exception.h"
+#include "core/utils/string_utils/to_string.h"
+
+namespace egret::fit::yc {
+// -----------------------------------------------------------------------------
+//  [struct] curve_slot
+// -----------------------------------------------------------------------------
+    /**
+     * @brief position of a curve in the flat array passed to evaluate.
+    */
+    struct curve_slot {
+        std::size_t index;
+
+        constexpr auto operator<=>(const curve_slot&) const noexcept = default;
+    };
+
+// -----------------------------------------------------------------------------
+//  [fn] throw_curve_not_found
+//  [fn] find_curve
+// -----------------------------------------------------------------------------
+    /**
+     * @brief throws that the curve of tag is not found. role such as "Discount" qualifies the curve in the message.
+    */
+    template <typename Tag>
+    [[noreturn]] void throw_curve_not_found(const Tag& tag, std::string_view role = {})
+    {
+        const auto curve = role.empty() ? std::string("Curve") : std::format("{} curve", role);
+        if constexpr (cpt::to_stringable<Tag, char>) {
+            throw exception("{} '{}' is not found.", curve, util::to_string(tag))
+                .record_stacktrace();
+        }
+        else {
+            throw exception("{} is not found.", curve)
+                .record_stacktrace();
+        }
+    }
+
+    /**
+     * @brief curve of tag in curves. throws by throw_curve_not_found if missing.
+    */
+    template <typename RateTag, typename Curve, typename Tag>
+    const Curve& find_curve(const std::map<RateTag, Curve>& curves, const Tag& tag, std::string_view role = {})
+    {
+        const auto it = curves.find(tag);
+        if (it == curves.end()) {
+            yc::throw_curve_not_found(tag, role);
+        }
+        return it->second;
+    }
+
+// -----------------------------------------------------------------------------
+//  [class] curve_layout
+// -----------------------------------------------------------------------------
+    /**
+     * @brief assigns slots to curve tags.
+     * @details tags are kept sorted, so the slot order agrees with the iteration order of std::map<RateTag, Curve>.
+    */
+    template <typename RateTag>
+    class curve_layout {
+    private:
+        using this_type = curve_layout;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        curve_layout() = delete;
+        curve_layout(const this_type&) = default;
+        curve_layout(this_type&&) noexcept = default;
+
+        explicit curve_layout(std::vector<RateTag> tags)
+            : tags_(std::move(tags))
+        {
+            std::ranges::sort(tags_);
+            const auto [first, last] = std::ranges::unique(tags_);
+            tags_.erase(first, last);
+        }
+
+        template <typename Curve>
+        explicit curve_layout(const std::map<RateTag, Curve>& curves)
+        {
+            tags_.reserve(curves.size());
+            for (const auto& [tag, _] : curves) {
+                tags_.push_back(tag);
+            }
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  slots
+    //
+        template <typename Tag>
+            requires std::strict_weak_order<std::less<>, const RateTag&, const Tag&>
+        curve_slot slot(const Tag& tag) const
+        {
+            const auto it = std::ranges::lower_bound(tags_, tag, std::less<> {});
+            if (it == tags_.end() || std::less<> {}(tag, *it)) {
+                yc::throw_curve_not_found(tag);
+            }
+            return curve_slot {static_cast<std::size_t>(it - tags_.begin())};
+        }
+
+        /**
+         * @brief curves of the map in slot order.
+        */
+        template <typename Curve>
+        std::vector<Curve> arrange(const std::map<RateTag, Curve>& curves) const
+        {
+            auto result = std::vector<Curve> {};
+            result.reserve(tags_.size());
+            for (const auto& tag : tags_) {
+                result.push_back(yc::find_curve(curves, tag));
+            }
+            return result;
+        }
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        const std::vector<RateTag>& tags() const noexcept { return tags_; }
+        std::size_t size() const noexcept { return tags_.size(); }
+
+    private:
+        std::vector<RateTag> tags_;
+
+    }; // class curve_layout
+
+} // namespace egret::fit::yc
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "core/utils/string_utils/to_string.h"
 #include "egret/chrono/daycounters/concepts.h"
 #include "egret/models/curves/discount_factor.h"
 #include "egret/instruments/cashflows/fixed_leg.h"
@@ -27,25 +26,54 @@ namespace egret::fit::yc {
             const std::map<RateTag, Curve>& curves
         ) const
         {
-            if (!curves.contains(header.discount_curve)) {
-                if constexpr (cpt::to_stringable<DiscountTag>) {
-                    throw exception("Discount curve '{}' is not found.", util::to_string(header.discount_curve))
-                        .record_stacktrace();
-                }
-                else {
-                    throw exception("Discount curve is not found.")
-                        .record_stacktrace();
-                }
-            }
+            return evaluate_with(header, cashflow, vdt, yc::find_curve(curves, header.discount_curve, "Discount"));
+        }
+
+        template <cpt::yield_curve Curve>
+            requires std::is_same_v<DiscountTag, curve_slot>
+        model::forward_rate_t<Curve> operator()(
+            const header_t& header, const cashflow_t& cashflow,
+            const std::chrono::sys_days& vdt, 
+            std::span<const Curve> curves
+        ) const
+        {
+            return evaluate_with(header, cashflow, vdt, curves[header.discount_curve.index]);
+        }
+
+    private:
+        template <cpt::yield_curve Curve>
+        static model::forward_rate_t<Curve> evaluate_with(
+            const header_t& header, const cashflow_t& cashflow,
+            const std::chrono::sys_days& vdt,
+            const Curve& dcurve
+        )
+        {
             using result_t = model::forward_rate_t<Curve>;
             if (cashflow.cashout_date <= vdt) {
                 return static_cast<result_t>(0);
             }
             const double notional = header.notional * cashflow.notional_ratio;
             const double dcf = chrono::dcf(header.accrual_daycounter, std::min(cashflow.accrual_start, vdt), cashflow.accrual_end);
-            auto df = model::discount_factor(curves.at(header.discount_curve), vdt, cashflow.payment_date);
+            auto df = model::discount_factor(dcurve, vdt, cashflow.payment_date);
+
+            return static_cast<result_t>(std::move(df) * (notional * dcf * cashflow.rate.value()));
+        }
+    };
 
-            return static_cast<result_t>(std::move(df) * (notional * dcf * cashflow.rate));
+// -----------------------------------------------------------------------------
+//  [struct] specializable_binder
+// -----------------------------------------------------------------------------
+    template <typename DiscountTag, typename DC, typename N>
+    struct specializable_binder<inst::cfs::fixed_leg_header<DiscountTag, DC, N>> {
+        template <typename RateTag>
+            requires std::strict_weak_order<std::less<>, const RateTag&, const DiscountTag&>
+        auto operator()(
+            const inst::cfs::fixed_leg_header<DiscountTag, DC, N>& header,
+            const curve_layout<RateTag>& layout
+        ) const
+            -> inst::cfs::fixed_leg_header<curve_slot, DC, N>
+        {
+            return {layout.slot(header.discount_curve), header.accrual_daycounter, header.notional};
         }
     };
 
@@ -9,6 +9,7 @@
 #include "swap_constraint.h"
 #include "fixed_leg.h"
 #include "term_rate_leg.h"
+#include "overnight_index_leg.h"
 
 namespace egret::fit::yc {
 // -----------------------------------------------------------------------------
@@ -57,6 +58,25 @@ namespace egret::fit::yc {
     {
         return {inst::cfs::to_dto(std::move(obj).pay_leg()), std::move(obj).receive_leg()};
     }
+
+// -----------------------------------------------------------------------------
+//  [fn] compile
+// -----------------------------------------------------------------------------
+    /**
+     * @brief precomputes the curve independent part of the overnight index leg.
+    */
+    template <typename DiscountTag, typename FloatingTag, typename DC>
+    auto compile(
+        const ois_constraint<DiscountTag, FloatingTag, DC>& obj,
+        overnight_index_compounding compounding = overnight_index_compounding::exact
+    )
+        -> compiled_swap_constraint<
+            compiled_overnight_index_leg<DiscountTag, FloatingTag, DC>,
+            typename ois_constraint<DiscountTag, FloatingTag, DC>::receiveleg_type
+        >
+    {
+        return {yc::compile(obj.pay_leg(), compounding), obj.receive_leg()};
+    }
     
 } // namespace egret::fit::yc
 
@@ -1,110 +1,510 @@
 #pragma once
 
-#include "core/utils/string_utils/to_string.h"
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
 #include "egret/chrono/daycounters/concepts.h"
 #include "egret/chrono/adjustments/add_bd.h"
-#include "egret/chrono/adjustments/prev_bd.h"
-#include "egret/chrono/adjustments/next_bd.h"
 #include "egret/models/curves/discount_factor.h"
 #include "egret/instruments/cashflows/overnight_index_leg.h"
 #include "cashflow_evaluator.h"
 
+namespace egret_detail::oil_impl {
+    enum class step_kind {
+        observed,
+        locked,
+    };
+
+    // dates spanned by a floating coupon. rates are observed daily in [observed_start, observed_end)
+    // and the weights of the whole coupon span [weight_start, weight_end).
+    struct walk_result {
+        std::chrono::sys_days observed_start;
+        std::chrono::sys_days observed_end;
+        std::chrono::sys_days weight_start;
+        std::chrono::sys_days weight_end;
+    };
+
+    // walks the business days of a floating coupon, calling sink(kind, rate_start, rate_end, weight_start, weight_end)
+    // for each step. observed steps come first. locked steps reuse the rate of the first date not observed.
+    template <typename Cal, typename Sink>
+    walk_result walk(const egret::inst::cfs::overnight_index_cashflow<>& cf, const Cal& cal, Sink&& sink)
+    {
+        namespace chrono = egret::chrono;
+        const auto next = [&cal](const std::chrono::sys_days& d) { return chrono::add_businessdays(cal, d, 1); };
+
+        const auto per_end = cf.accrual_end | chrono::add_bd(-cf.backward_shift - cf.lookback, cal);
+        const auto ref_end = per_end | chrono::add_bd(-cf.lockout, cal);
+        const auto weight_start = cf.accrual_start | chrono::add_bd(-cf.backward_shift, cal);
+        auto weight_cursor = weight_start;
+        auto rate_cursor = weight_cursor | chrono::add_bd(-cf.lookback, cal);
+
+        const auto observed_start = rate_cursor;
+        while (rate_cursor < ref_end) {
+            const auto rate_next = next(rate_cursor);
+            // weights coincide with the observed steps without lookback
+            const auto weight_next = cf.lookback.count() == 0 ? rate_next : next(weight_cursor);
+            sink(step_kind::observed, rate_cursor, rate_next, weight_cursor, weight_next);
+            rate_cursor = rate_next;
+            weight_cursor = weight_next;
+        }
+        const auto observed_end = rate_cursor;
+
+        if (rate_cursor < per_end) {
+            const auto locked_end = next(observed_end);
+            while (rate_cursor < per_end) {
+                const auto weight_next = next(weight_cursor);
+                sink(step_kind::locked, observed_end, locked_end, weight_cursor, weight_next);
+                rate_cursor = next(rate_cursor);
+                weight_cursor = weight_next;
+            }
+        }
+        return {observed_start, observed_end, weight_start, weight_cursor};
+    }
+
+    // simple forward rate of a step from its projection discount factor
+    template <typename T>
+    auto forward(T pdf, double fwd_dcf)
+    {
+        return (1 / std::move(pdf) - 1) / fwd_dcf;
+    }
+
+    // present value of a coupon whose compounded growth factor over the period is rate
+    template <typename D, typename T>
+    auto coupon_value(D df, T rate, double period_dcf, double gearing, double spread, double notional, double dcf)
+    {
+        auto coupon_rate = (std::move(rate) - 1) / period_dcf * gearing + spread;
+        return std::move(df) * (notional * dcf * std::move(coupon_rate));
+    }
+
+} // namespace egret_detail::oil_impl
+
 namespace egret::fit::yc {
+// -----------------------------------------------------------------------------
+//  [enum] overnight_index_compounding
+// -----------------------------------------------------------------------------
+    /**
+     * @brief how compile() evaluates the observed part of compounded overnight coupons.
+     * @details
+     *  exact: coupons without lookback telescope, i.e. prod 1/DF(t_i, t_i+1) = 1/DF(t_0, t_n), and are
+     *      evaluated with a single discount factor. coupons with lookback are compounded daily.
+     *  approximate: coupons with lookback are evaluated as (1/DF(t_0, t_n))^(W/T), where W and T are the sums
+     *      of weight and rate day count fractions of the observed steps. with forwards f_i, rate dcfs tau_i and
+     *      weight dcfs w_i of the steps and their mean forward f, the log of the compounded factor is off by
+     *          sum_i (f_i - f) (w_i - tau_i W/T) + f^2 / 2 sum_i w_i (tau_i - w_i)
+     *      up to higher orders. the second term remains for a flat forward since lookback moves weekends
+     *      away from the weights, e.g. about 0.02bp of a quarterly coupon at 5% with 2 days lookback.
+     *      the first term grows with the forward slope, e.g. about 1bp for a slope of 4% a year.
+     *  the lockout part is always evaluated exactly.
+    */
+    enum class overnight_index_compounding {
+        exact,
+        approximate,
+    };
+
+// -----------------------------------------------------------------------------
+//  [struct] compiled_overnight_index_coupon
+// -----------------------------------------------------------------------------
+    struct compiled_overnight_index_coupon {
+        double notional;
+        std::chrono::sys_days accrual_start;
+        std::chrono::sys_days accrual_end;
+        std::chrono::sys_days payment_date;
+        std::chrono::sys_days cashout_date;
+        double accrual_dcf;
+        std::optional<double> fixed_rate;
+        double gearing;
+        double spread;
+
+        // observed part as a single period (see overnight_index_compounding), or
+        // steps [first, lockout) observed daily. [lockout, last) reuse the rate of steps[lockout].
+        bool summarized;
+        std::chrono::sys_days observed_start;
+        std::chrono::sys_days observed_end;
+        double observed_exponent;
+        std::size_t first;
+        std::size_t lockout;
+        std::size_t last;
+        double period_dcf;
+    };
+
+// -----------------------------------------------------------------------------
+//  [class] compiled_overnight_index_leg
+// -----------------------------------------------------------------------------
+    /**
+     * @brief curve independent evaluation plan of an overnight index leg.
+     * @details business day walks and day count fractions depend only on cashflows and the calendar,
+     *  so they are resolved once on construction. evaluate() only queries the curves.
+    */
+    template <typename DiscountTag, typename RateTag, typename DC>
+    class compiled_overnight_index_leg {
+    private:
+        using this_type = compiled_overnight_index_leg;
+
+    public:
+        using header_t = inst::cfs::overnight_index_leg_header<DiscountTag, RateTag, DC>;
+        using cashflow_t = inst::cfs::overnight_index_cashflow<>;
+
+        using coupon = compiled_overnight_index_coupon;
+
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        compiled_overnight_index_leg() = delete;
+        compiled_overnight_index_leg(const this_type&) = default;
+        compiled_overnight_index_leg(this_type&&) noexcept = default;
+
+        compiled_overnight_index_leg(
+            const header_t& header,
+            std::span<const cashflow_t> cashflows,
+            overnight_index_compounding compounding = overnight_index_compounding::exact
+        )
+            : discount_curve_(header.discount_curve),
+              projection_curve_(header.projection_curve),
+              accrual_daycounter_(header.accrual_daycounter)
+        {
+            namespace oil_impl = egret_detail::oil_impl;
+            auto weight_starts = std::vector<std::chrono::sys_days> {};
+            auto weight_ends = std::vector<std::chrono::sys_days> {};
+            coupons_.reserve(cashflows.size());
+            for (const auto& cf : cashflows) {
+                auto& cpn = coupons_.emplace_back(coupon {
+                    .notional = header.notional * cf.notional_ratio,
+                    .accrual_start = cf.accrual_start,
+                    .accrual_end = cf.accrual_end,
+                    .payment_date = cf.payment_date,
+                    .cashout_date = cf.cashout_date,
+                    .accrual_dcf = chrono::dcf(header.accrual_daycounter, cf.accrual_start, cf.accrual_end),
+                    .fixed_rate = cf.fixed_coupon_rate ? std::optional<double>(cf.fixed_coupon_rate->value()) : std::nullopt,
+                    .gearing = cf.gearing,
+                    .spread = cf.spread.value(),
+                    .summarized = cf.lookback.count() == 0 || compounding == overnight_index_compounding::approximate,
+                    .observed_start = {},
+                    .observed_end = {},
+                    .observed_exponent = 1.,
+                    .first = rate_starts_.size(),
+                    .lockout = rate_starts_.size(),
+                    .last = rate_starts_.size(),
+                    .period_dcf = 1.
+                });
+                if (cpn.fixed_rate || cf.accrual_start == cf.accrual_end) {
+                    continue;
+                }
+
+                // steps observed daily and locked steps are recorded, summarized ones only sum up their dcfs.
+                double observed_weight = 0.;
+                double observed_fwd = 0.;
+                std::size_t locked_steps = 0;
+                const auto walk = oil_impl::walk(cf, header.rate_reference_calendar, [&](
+                    oil_impl::step_kind kind,
+                    const std::chrono::sys_days& rate_start, const std::chrono::sys_days& rate_end,
+                    const std::chrono::sys_days& weight_start, const std::chrono::sys_days& weight_end
+                ) {
+                    if (kind == oil_impl::step_kind::locked || !cpn.summarized) {
+                        rate_starts_.push_back(rate_start);
+                        rate_ends_.push_back(rate_end);
+                        weight_starts.push_back(weight_start);
+                        weight_ends.push_back(weight_end);
+                        locked_steps += kind == oil_impl::step_kind::locked;
+                    }
+                    else if (cf.lookback.count() != 0) {
+                        observed_fwd += chrono::dcf(header.rate_daycounter, rate_start, rate_end);
+                        observed_weight += chrono::dcf(header.rate_daycounter, weight_start, weight_end);
+                    }
+                });
+                cpn.observed_start = walk.observed_start;
+                cpn.observed_end = walk.observed_end;
+                if (observed_fwd > 0.) {
+                    cpn.observed_exponent = observed_weight / observed_fwd;
+                }
+                cpn.lockout = rate_starts_.size() - locked_steps;
+                cpn.last = rate_starts_.size();
+                cpn.period_dcf = chrono::dcf(header.rate_daycounter, walk.weight_start, walk.weight_end);
+            }
+
+            fwd_dcfs_.resize(rate_starts_.size());
+            weight_dcfs_.resize(rate_starts_.size());
+            chrono::dcf(
+                header.rate_daycounter,
+                std::span<const std::chrono::sys_days>(rate_starts_),
+                std::span<const std::chrono::sys_days>(rate_ends_),
+                std::span<double>(fwd_dcfs_)
+            );
+            chrono::dcf(
+                header.rate_daycounter,
+                std::span<const std::chrono::sys_days>(weight_starts),
+                std::span<const std::chrono::sys_days>(weight_ends),
+                std::span<double>(weight_dcfs_)
+            );
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  yield_curve_evaluator behavior
+    //
+        template <typename Tag, cpt::yield_curve Curve>
+            requires
+                std::strict_weak_order<std::less<>, const Tag&, const DiscountTag&> &&
+                std::strict_weak_order<std::less<>, const Tag&, const RateTag&>
+        model::forward_rate_t<Curve> evaluate(const std::chrono::sys_days& vdt, const std::map<Tag, Curve>& curves) const
+        {
+            return this->evaluate_with(
+                vdt,
+                yc::find_curve(curves, discount_curve_, "Discount"),
+                yc::find_curve(curves, projection_curve_, "Projection")
+            );
+        }
+
+        template <cpt::yield_curve Curve>
+            requires std::is_same_v<DiscountTag, curve_slot> && std::is_same_v<RateTag, curve_slot>
+        model::forward_rate_t<Curve> evaluate(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const
+        {
+            return this->evaluate_with(vdt, curves[discount_curve_.index], curves[projection_curve_.index]);
+        }
+
+    // -------------------------------------------------------------------------
+    //  bind
+    //
+        template <typename Tag>
+            requires
+                std::strict_weak_order<std::less<>, const Tag&, const DiscountTag&> &&
+                std::strict_weak_order<std::less<>, const Tag&, const RateTag&>
+        auto bind(const curve_layout<Tag>& layout) const -> compiled_overnight_index_leg<curve_slot, curve_slot, DC>
+        {
+            return {layout.slot(discount_curve_), layout.slot(projection_curve_), *this};
+        }
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        const std::vector<coupon>& coupons() const noexcept { return coupons_; }
+
+    private:
+        template <typename, typename, typename>
+        friend class compiled_overnight_index_leg;
+
+        template <typename D, typename R>
+        compiled_overnight_index_leg(DiscountTag discount_curve, RateTag projection_curve, const compiled_overnight_index_leg<D, R, DC>& other)
+            : discount_curve_(std::move(discount_curve)),
+              projection_curve_(std::move(projection_curve)),
+              accrual_daycounter_(other.accrual_daycounter_),
+              coupons_(other.coupons_),
+              rate_starts_(other.rate_starts_),
+              rate_ends_(other.rate_ends_),
+              fwd_dcfs_(other.fwd_dcfs_),
+              weight_dcfs_(other.weight_dcfs_)
+        {
+        }
+
+        template <cpt::yield_curve Curve>
+        model::forward_rate_t<Curve> evaluate_with(const std::chrono::sys_days& vdt, const Curve& dcurve, const Curve& pcurve) const
+        {
+            using result_t = model::forward_rate_t<Curve>;
+            result_t result = 0;
+            for (const auto& cpn : coupons_) {
+                result += this->evaluate_coupon(cpn, vdt, dcurve, pcurve);
+            }
+            return result;
+        }
+
+        template <cpt::yield_curve Curve>
+        model::forward_rate_t<Curve> evaluate_coupon(
+            const coupon& cpn,
+            const std::chrono::sys_days& vdt,
+            const Curve& dcurve,
+            const Curve& pcurve
+        ) const
+        {
+            using result_t = model::forward_rate_t<Curve>;
+            if (cpn.cashout_date <= vdt || cpn.accrual_start == cpn.accrual_end) {
+                return static_cast<result_t>(0);
+            }
+            const double dcf = vdt < cpn.accrual_start
+                ? chrono::dcf(accrual_daycounter_, vdt, cpn.accrual_end)
+                : cpn.accrual_dcf;
+            auto df = model::discount_factor(dcurve, vdt, cpn.payment_date);
+
+            if (cpn.fixed_rate) {
+                return static_cast<result_t>(std::move(df) * (cpn.notional * dcf * *(cpn.fixed_rate)));
+            }
+
+            result_t rate = 1;
+            if (cpn.summarized) {
+                if (cpn.observed_start < cpn.observed_end) {
+                    using std::pow;
+                    auto pdf = model::discount_factor(pcurve, cpn.observed_start, cpn.observed_end);
+                    rate = cpn.observed_exponent == 1.
+                        ? static_cast<result_t>(1 / std::move(pdf))
+                        : static_cast<result_t>(pow(1 / std::move(pdf), cpn.observed_exponent));
+                }
+            }
+            namespace oil_impl = egret_detail::oil_impl;
+            for (std::size_t i = cpn.first; i != cpn.lockout; ++i) {
+                auto pdf = model::discount_factor(pcurve, rate_starts_[i], rate_ends_[i]);
+                rate *= 1 + oil_impl::forward(std::move(pdf), fwd_dcfs_[i]) * weight_dcfs_[i];
+            }
+            if (cpn.lockout != cpn.last) {
+                auto pdf = model::discount_factor(pcurve, rate_starts_[cpn.lockout], rate_ends_[cpn.lockout]);
+                const result_t locked_rate = oil_impl::forward(std::move(pdf), fwd_dcfs_[cpn.lockout]);
+                for (std::size_t i = cpn.lockout; i != cpn.last; ++i) {
+                    rate *= 1 + locked_rate * weight_dcfs_[i];
+                }
+            }
+            return static_cast<result_t>(
+                oil_impl::coupon_value(std::move(df), std::move(rate), cpn.period_dcf, cpn.gearing, cpn.spread, cpn.notional, dcf)
+            );
+        }
+
+        DiscountTag discount_curve_;
+        RateTag projection_curve_;
+        DC accrual_daycounter_;
+        std::vector<coupon> coupons_;
+        std::vector<std::chrono::sys_days> rate_starts_;
+        std::vector<std::chrono::sys_days> rate_ends_;
+        std::vector<double> fwd_dcfs_;
+        std::vector<double> weight_dcfs_;
+
+    }; // class compiled_overnight_index_leg
+
+// -----------------------------------------------------------------------------
+//  [fn] compile
+// -----------------------------------------------------------------------------
+    template <typename DiscountTag, typename RateTag, typename DC>
+    compiled_overnight_index_leg<DiscountTag, RateTag, DC> compile(
+        const inst::cfs::overnight_index_leg<DiscountTag, RateTag, DC>& leg,
+        overnight_index_compounding compounding = overnight_index_compounding::exact
+    )
+    {
+        return {leg.header(), leg.cashflows(), compounding};
+    }
+
 // -----------------------------------------------------------------------------
 //  [struct] cashflow_evaluator
 // -----------------------------------------------------------------------------
     template <typename DiscountTag, typename RateTag, typename DC>
     struct cashflow_evaluator<
-        inst::cfs::overnight_index_leg_header<DiscountTag, RateTag, DC>, 
+        inst::cfs::overnight_index_leg_header<DiscountTag, RateTag, DC>,
         inst::cfs::overnight_index_cashflow<>
     > {
-        
+
         using header_t = inst::cfs::overnight_index_leg_header<DiscountTag, RateTag, DC>;
         using cashflow_t = inst::cfs::overnight_index_cashflow<>;
 
-        template <typename RateTag, cpt::yield_curve Curve>
-            requires 
-                std::strict_weak_order<std::less<>, const RateTag&, const DiscountTag&> &&
-                std::strict_weak_order<std::less<>, const RateTag&, const RateTag&>
+        /**
+         * @brief evaluates a single cashflow by walking business days directly, same as compile() with exact compounding.
+         * @details nothing is allocated. compile the whole leg when it is evaluated repeatedly.
+        */
+        template <typename Tag, cpt::yield_curve Curve>
+            requires
+                std::strict_weak_order<std::less<>, const Tag&, const DiscountTag&> &&
+                std::strict_weak_order<std::less<>, const Tag&, const RateTag&>
         model::forward_rate_t<Curve> operator()(
             const header_t& header, const cashflow_t& cashflow,
-            const std::chrono::sys_days& vdt, 
-            const std::map<RateTag, Curve>& curves
+            const std::chrono::sys_days& vdt,
+            const std::map<Tag, Curve>& curves
         ) const
         {
-            if (!curves.contains(header.discount_curve)) {
-                if constexpr (cpt::to_stringable<DiscountTag>) {
-                    throw exception("Discount curve '{}' is not found.", util::to_string(header.discount_curve))
-                        .record_stacktrace();
-                }
-                else {
-                    throw exception("Discount curve is not found.")
-                        .record_stacktrace();
-                }
-            }
-            if (!curves.contains(header.projection_curve)) {
-                if constexpr (cpt::to_stringable<RateTag>) {
-                    throw exception("Projection curve '{}' is not found.", util::to_string(header.projection_curve))
-                        .record_stacktrace();
-                }
-                else {
-                    throw exception("Projection curve is not found.")
-                        .record_stacktrace();
-                }
-            }
+            return this->evaluate_with(
+                header, cashflow, vdt,
+                yc::find_curve(curves, header.discount_curve, "Discount"),
+                yc::find_curve(curves, header.projection_curve, "Projection")
+            );
+        }
 
+        template <cpt::yield_curve Curve>
+            requires std::is_same_v<DiscountTag, curve_slot> && std::is_same_v<RateTag, curve_slot>
+        model::forward_rate_t<Curve> operator()(
+            const header_t& header, const cashflow_t& cashflow,
+            const std::chrono::sys_days& vdt,
+            std::span<const Curve> curves
+        ) const
+        {
+            return this->evaluate_with(header, cashflow, vdt, curves[header.discount_curve.index], curves[header.projection_curve.index]);
+        }
+
+    private:
+        template <cpt::yield_curve Curve>
+        model::forward_rate_t<Curve> evaluate_with(
+            const header_t& header, const cashflow_t& cashflow,
+            const std::chrono::sys_days& vdt,
+            const Curve& dcurve,
+            const Curve& pcurve
+        ) const
+        {
             using result_t = model::forward_rate_t<Curve>;
             if (cashflow.cashout_date <= vdt || cashflow.accrual_start == cashflow.accrual_end) {
                 return static_cast<result_t>(0);
             }
             const double notional = header.notional * cashflow.notional_ratio;
             const double dcf = chrono::dcf(header.accrual_daycounter, std::min(cashflow.accrual_start, vdt), cashflow.accrual_end);
-            auto df = model::discount_factor(curves.at(header.discount_curve), vdt, cashflow.payment_date);
+            auto df = model::discount_factor(dcurve, vdt, cashflow.payment_date);
 
             if (cashflow.fixed_coupon_rate) {
-                const double cpn = *(cashflow.fixed_coupon_rate);
-                return static_cast<result_t>(std::move(df) * (notional * dcf * cpn);
+                return static_cast<result_t>(std::move(df) * (notional * dcf * cashflow.fixed_coupon_rate->value()));
             }
 
-            const auto& pcurve = curves.at(header.projection_curve);
-            const auto next = chrono::next_bd(header.rate_reference_calendar);
-
-            const auto per_end = cashflow.accrual_end | chrono::add_bd(-cashflow.backward_shift - cashflow.lookback, header.rate_reference_calendar);
-            const auto ref_end = per_end | chrono::add_bd(-cashflow.lockout, header.rate_reference_calendar);
-            const auto weight_start = cashflow.accrual_start | chrono::add_bd(-cashflow.backward_shift, header.rate_reference_calendar);
-            auto weight_cursor = weight_start;
-            auto rate_cursor = weight_cursor | chrono::add_bd(-cashflow.lookback, header.rate_reference_calendar);
-
-            result_t rate = 0;
-            while (rate_cursor < ref_end) {
-                const auto rate_stt = rate_cursor;
-                const auto weight_stt = weight_cursor;
-                rate_cursor = next(rate_cursor);
-                weight_cursor = next(weight_cursor);
-                auto pdf = model::discount_factor(pcurve, rate_stt, rate_cursor);
-                const auto fwd_dcf = chrono::dcf(header.rate_daycounter, rate_stt, rate_cursor);
-                const auto pdcf = chrono::dcf(header.rate_daycounter, weight_stt, weight_cursor);
-                rate *= 1 + (1 / std::move(pdf) - 1) / fwd_dcf * pdcf;
-            }
-            const auto locked_rate = [&pcurve, &rate_cursor, &next, &header]{
-                const auto next_date = rate_cursor | next;
-                auto pdf = model::discount_factor(pcurve, rate_cursor, next_date);
-                const auto fwd_dcf = chrono::dcf(header.rate_daycounter, rate_cursor, next_date);
-                const auto pdcf = chrono::dcf(header.rate_daycounter, rate_cursor, next_date);
-                return (1 / std::move(pdf) - 1) / fwd_dcf;
-            }();
-            while (rate_cursor < per_end) {
-                const auto weight_stt = weight_cursor;
-                rate_cursor = next(rate_cursor);
-                weight_cursor = next(weight_cursor);
-                const auto pdcf = chrono::dcf(header.rate_daycounter, weight_stt, weight_cursor);
-                rate *= 1 + locked_rate * pdcf;
+            // without lookback, weights coincide with the observed steps, so that the daily product telescopes
+            namespace oil_impl = egret_detail::oil_impl;
+            const bool telescopes = cashflow.lookback.count() == 0;
+            result_t rate = 1;
+            std::optional<result_t> locked_rate;
+            const auto walk = oil_impl::walk(cashflow, header.rate_reference_calendar, [&](
+                oil_impl::step_kind kind,
+                const std::chrono::sys_days& rate_start, const std::chrono::sys_days& rate_end,
+                const std::chrono::sys_days& weight_start, const std::chrono::sys_days& weight_end
+            ) {
+                if (kind == oil_impl::step_kind::observed && telescopes) {
+                    return;
+                }
+                const auto weight_dcf = chrono::dcf(header.rate_daycounter, weight_start, weight_end);
+                if (kind == oil_impl::step_kind::observed) {
+                    auto pdf = model::discount_factor(pcurve, rate_start, rate_end);
+                    rate *= 1 + oil_impl::forward(std::move(pdf), chrono::dcf(header.rate_daycounter, rate_start, rate_end)) * weight_dcf;
+                    return;
+                }
+                if (!locked_rate) {
+                    auto pdf = model::discount_factor(pcurve, rate_start, rate_end);
+                    locked_rate.emplace(oil_impl::forward(std::move(pdf), chrono::dcf(header.rate_daycounter, rate_start, rate_end)));
+                }
+                rate *= 1 + *locked_rate * weight_dcf;
+            });
+            if (telescopes && walk.observed_start < walk.observed_end) {
+                rate *= static_cast<result_t>(1 / model::discount_factor(pcurve, walk.observed_start, walk.observed_end));
             }
+            return static_cast<result_t>(oil_impl::coupon_value(
+                std::move(df), std::move(rate),
+                chrono::dcf(header.rate_daycounter, walk.weight_start, walk.weight_end),
+                cashflow.gearing, cashflow.spread.value(), notional, dcf
+            ));
+        }
+    };
 
-            rate = (std::move(rate) - 1) / chrono::dcf(header.rate_daycounter, weight_start, weight_cursor);
-            auto cpn = std::move(rate) * cashflow.gearing + cashflow.spread.value();
-
-            return static_cast<result_t>(std::move(df) * (notional * dcf * std::move(cpn));
+// -----------------------------------------------------------------------------
+//  [struct] specializable_binder
+// -----------------------------------------------------------------------------
+    template <typename DiscountTag, typename RateTag, typename DC, typename Cal, typename N>
+    struct specializable_binder<inst::cfs::overnight_index_leg_header<DiscountTag, RateTag, DC, Cal, N>> {
+        template <typename Tag>
+            requires
+                std::strict_weak_order<std::less<>, const Tag&, const DiscountTag&> &&
+                std::strict_weak_order<std::less<>, const Tag&, const RateTag&>
+        auto operator()(
+            const inst::cfs::overnight_index_leg_header<DiscountTag, RateTag, DC, Cal, N>& header,
+            const curve_layout<Tag>& layout
+        ) const
+            -> inst::cfs::overnight_index_leg_header<curve_slot, curve_slot, DC, Cal, N>
+        {
+            return {
+                layout.slot(header.discount_curve),
+                layout.slot(header.projection_curve),
+                header.rate_daycounter,
+                header.accrual_daycounter,
+                header.rate_reference_calendar,
+                header.notional
+            };
         }
     };
 
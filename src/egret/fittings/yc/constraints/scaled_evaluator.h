@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <nlohmann/json_fwd.hpp>
 #include "core/utils/json_utils/j2obj.h"
 #include "egret/models/curves/concepts.h"
@@ -56,6 +57,26 @@ namespace egret::fit::yc {
             return result_t {scale_ * yc::evaluate(base_, vdt, curves)};
         }
 
+        template <cpt::yield_curve Curve>
+            requires cpt::bound_yield_curve_evaluator<Base, Curve>
+        auto evaluate(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const
+            -> bound_evaluate_result_t<Base, Curve>
+        {
+            using result_t = bound_evaluate_result_t<Base, Curve>;
+            return result_t {scale_ * yc::evaluate(base_, vdt, curves)};
+        }
+
+    // -------------------------------------------------------------------------
+    //  bind
+    //
+        template <typename RateTag>
+            requires cpt::bindable_evaluator<Base, RateTag>
+        auto bind(const curve_layout<RateTag>& layout) const
+            -> scaled_evaluator<bind_result_t<Base, RateTag>>
+        {
+            return {yc::bind(base_, layout), scale_};
+        }
+
     // -------------------------------------------------------------------------
     //  get
     //
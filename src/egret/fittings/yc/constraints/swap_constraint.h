@@ -4,6 +4,9 @@
 #include "egret/instruments/cashflows/leg.h"
 
 namespace egret::fit::yc {
+    template <typename PayLeg, typename ReceiveLeg>
+    class compiled_swap_constraint;
+
 // -----------------------------------------------------------------------------
 //  [class] swap_constraint
 // -----------------------------------------------------------------------------
@@ -51,6 +54,19 @@ namespace egret::fit::yc {
             return std::move(rec) - std::move(pay);
         }
 
+    // -------------------------------------------------------------------------
+    //  bind
+    //
+        template <typename RateTag>
+            requires
+                cpt::bindable_evaluator<payleg_type, RateTag> &&
+                cpt::bindable_evaluator<receiveleg_type, RateTag>
+        auto bind(const curve_layout<RateTag>& layout) const
+            -> compiled_swap_constraint<bind_result_t<payleg_type, RateTag>, bind_result_t<receiveleg_type, RateTag>>
+        {
+            return {yc::bind(pay_, layout), yc::bind(rec_, layout)};
+        }
+
     // -------------------------------------------------------------------------
     //  get
     //
@@ -66,4 +82,87 @@ namespace egret::fit::yc {
 
     }; // class swap_constraint
 
+// -----------------------------------------------------------------------------
+//  [class] compiled_swap_constraint
+// -----------------------------------------------------------------------------
+    /**
+     * @brief swap_constraint whose legs are arbitrary evaluators, e.g. the result of compile(leg).
+    */
+    template <typename PayLeg, typename ReceiveLeg>
+    class compiled_swap_constraint {
+    private:
+        using this_type = compiled_swap_constraint;
+
+    public:
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        compiled_swap_constraint() = delete;
+        compiled_swap_constraint(const this_type&) = default;
+        compiled_swap_constraint(this_type&&)
+            noexcept(std::is_nothrow_move_constructible_v<PayLeg> &&
+                     std::is_nothrow_move_constructible_v<ReceiveLeg>) = default;
+
+        compiled_swap_constraint(PayLeg pay_leg, ReceiveLeg rec_leg)
+            noexcept(std::is_nothrow_move_constructible_v<PayLeg> &&
+                     std::is_nothrow_move_constructible_v<ReceiveLeg>)
+            : pay_(std::move(pay_leg)), rec_(std::move(rec_leg))
+        {
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&)
+            noexcept(std::is_nothrow_move_assignable_v<PayLeg> &&
+                     std::is_nothrow_move_assignable_v<ReceiveLeg>) = default;
+
+    // -------------------------------------------------------------------------
+    //  yield_curve_evaluator behavior
+    //
+        template <typename RateTag, cpt::yield_curve Curve>
+            requires 
+                cpt::yield_curve_evaluator<PayLeg, RateTag, Curve> &&
+                cpt::yield_curve_evaluator<ReceiveLeg, RateTag, Curve>
+        auto evaluate(const std::chrono::sys_days& vdt, const std::map<RateTag, Curve>& curves) const
+        {
+            auto rec = yc::evaluate(rec_, vdt, curves);
+            auto pay = yc::evaluate(pay_, vdt, curves);
+            return std::move(rec) - std::move(pay);
+        }
+
+        template <cpt::yield_curve Curve>
+            requires 
+                cpt::bound_yield_curve_evaluator<PayLeg, Curve> &&
+                cpt::bound_yield_curve_evaluator<ReceiveLeg, Curve>
+        auto evaluate(const std::chrono::sys_days& vdt, std::span<const Curve> curves) const
+        {
+            auto rec = yc::evaluate(rec_, vdt, curves);
+            auto pay = yc::evaluate(pay_, vdt, curves);
+            return std::move(rec) - std::move(pay);
+        }
+
+    // -------------------------------------------------------------------------
+    //  bind
+    //
+        template <typename RateTag>
+            requires
+                cpt::bindable_evaluator<PayLeg, RateTag> &&
+                cpt::bindable_evaluator<ReceiveLeg, RateTag>
+        auto bind(const curve_layout<RateTag>& layout) const
+            -> compiled_swap_constraint<bind_result_t<PayLeg, RateTag>, bind_result_t<ReceiveLeg, RateTag>>
+        {
+            return {yc::bind(pay_, layout), yc::bind(rec_, layout)};
+        }
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        const PayLeg& pay_leg() const noexcept { return pay_; }
+        const ReceiveLeg& receive_leg() const noexcept { return rec_; }
+
+    private:
+        PayLeg pay_;
+        ReceiveLeg rec_;
+
+    }; // class compiled_swap_constraint
+
 } // namespace egret::fit::yc
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <span>
+#include <vector>
+#include "core/assertions/assertion.h"
+#include "core/assertions/exception.h"
+#include "core/math/interp1d/linear.h"
+#include "egret/models/curves/log_df_based_yield_curve.h"
+
+namespace egret::fit::yc {
+// -----------------------------------------------------------------------------
+//  [struct] make_linear_interpolant
+// -----------------------------------------------------------------------------
+    struct make_linear_interpolant {
+        template <typename V>
+        auto operator()(std::vector<std::chrono::sys_days> grids, std::vector<V> values) const
+        {
+            return math::interp1d::linear<std::chrono::sys_days, V>(std::move(grids), std::move(values));
+        }
+    };
+
+// -----------------------------------------------------------------------------
+//  [class] log_df_parametrization
+// -----------------------------------------------------------------------------
+    /**
+     * @brief curves parametrized by -log(DF) at their pillars.
+     * @details
+     *  each curve is a log_df_based_yield_curve over the interpolant made from knots (anchor, 0), (pillar_i, x_i).
+     *  parameters are laid out curve by curve in the order of tags, and pillar by pillar within a curve.
+     *  build also accepts parameters of math::autodiff::dual if MakeInterp does, so that curves carry
+     *  gradients with respect to the parameters.
+    */
+    template <typename RateTag, typename MakeInterp = make_linear_interpolant>
+    class log_df_parametrization {
+    private:
+        using this_type = log_df_parametrization;
+
+    public:
+        template <typename V = double>
+        using interpolant_type = std::invoke_result_t<const MakeInterp&, std::vector<std::chrono::sys_days>, std::vector<V>>;
+
+        template <typename V = double>
+        using curve_type = model::log_df_based_yield_curve<interpolant_type<V>>;
+
+    // -------------------------------------------------------------------------
+    //  ctors, dtor and assigns
+    //
+        log_df_parametrization() = delete;
+        log_df_parametrization(const this_type&) = default;
+        log_df_parametrization(this_type&&) noexcept = default;
+
+        log_df_parametrization(
+            std::chrono::sys_days anchor,
+            std::map<RateTag, std::vector<std::chrono::sys_days>> pillars,
+            MakeInterp make_interp = {}
+        )
+            : anchor_(anchor), pillars_(std::move(pillars)), make_interp_(std::move(make_interp))
+        {
+            offsets_.reserve(pillars_.size() + 1);
+            offsets_.push_back(0);
+            for (const auto& [tag, dates] : pillars_) {
+                if (dates.empty()) {
+                    throw exception("Each curve must have one pillar at least.").record_stacktrace();
+                }
+                if (dates.front() <= anchor_ || !std::ranges::is_sorted(dates, std::ranges::less_equal {})) {
+                    throw exception(
+                        "Pillars must be strictly increasing and after the anchor date. [anchor={}, first_pillar={}]",
+                        anchor_, dates.front()
+                    ).record_stacktrace();
+                }
+                offsets_.push_back(offsets_.back() + dates.size());
+            }
+        }
+
+        this_type& operator =(const this_type&) = default;
+        this_type& operator =(this_type&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    //  parametrization behavior
+    //
+        std::size_t size() const noexcept { return offsets_.back(); }
+
+        /**
+         * @brief one past the last parameter of the curve which the k-th parameter belongs to.
+        */
+        std::size_t segment_end(std::size_t k) const noexcept
+        {
+            return *std::ranges::upper_bound(offsets_, k);
+        }
+
+        template <typename V>
+            requires std::invocable<const MakeInterp&, std::vector<std::chrono::sys_days>, std::vector<V>>
+        std::map<RateTag, curve_type<V>> build(std::span<const V> params) const
+        {
+            egret::assertion(params.size() == this->size(), "Parameter size mismatch. [expected={}, actual={}]", this->size(), params.size());
+            auto result = std::map<RateTag, curve_type<V>> {};
+            auto offset = params.begin();
+            for (const auto& [tag, dates] : pillars_) {
+                auto grids = std::vector<std::chrono::sys_days> {};
+                auto values = std::vector<V> {};
+                grids.reserve(dates.size() + 1);
+                values.reserve(dates.size() + 1);
+                grids.push_back(anchor_);
+                values.push_back(V(0));
+                grids.insert(grids.end(), dates.begin(), dates.end());
+                values.insert(values.end(), offset, offset + dates.size());
+                offset += dates.size();
+                result.emplace(tag, curve_type<V>(std::invoke(make_interp_, std::move(grids), std::move(values))));
+            }
+            return result;
+        }
+
+    // -------------------------------------------------------------------------
+    //  get
+    //
+        const std::chrono::sys_days& anchor() const noexcept { return anchor_; }
+        const std::map<RateTag, std::vector<std::chrono::sys_days>>& pillars() const noexcept { return pillars_; }
+
+    private:
+        std::chrono::sys_days anchor_;
+        std::map<RateTag, std::vector<std::chrono::sys_days>> pillars_;
+        std::vector<std::size_t> offsets_;
+        MakeInterp make_interp_;
+
+    }; // class log_df_parametrization
+
+} // namespace egret::fit::yc
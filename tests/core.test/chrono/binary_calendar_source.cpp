@@ -0,0 +1,101 @@
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include "core/assertions/exception.h"
+#include "core/chrono/calendars/binary_calendar_source.h"
+#include "core/chrono/calendars/json_map_calendar_source.h"
+
+TEST(binary_calendar_source, roundtrip) {
+    const auto json = nlohmann::json::parse(R"({
+        "TKY": {
+            "additional_holidays": ["2024-01-01", "2024-01-02", "2024-01-03"],
+            "additional_businessdays": []
+        },
+        "NYK": {
+            "additional_holidays": ["2024-01-01", "2024-07-04"],
+            "additional_businessdays": ["2024-06-01"]
+        }
+    })");
+    const auto src = egret::chrono::json_map_calendar_source(json);
+    const auto codes = std::vector<std::string> {"TKY", "NYK"};
+    const auto path = std::filesystem::temp_directory_path() / "egret_binary_calendar_source_roundtrip.bin";
+
+    egret::chrono::write_binary_calendar_snapshot(path, src, codes);
+    {
+        const auto bin = egret::chrono::binary_calendar_source(path);
+        EXPECT_EQ((std::vector<std::string> {"NYK", "TKY"}), bin.codes());
+        for (const auto& code : codes) {
+            EXPECT_EQ(src.get_additional_holidays(code), bin.get_additional_holidays(code));
+            EXPECT_EQ(src.get_additional_businessdays(code), bin.get_additional_businessdays(code));
+        }
+        EXPECT_FALSE(bin.get_additional_holidays("LDN").has_value());
+        EXPECT_FALSE(bin.get_additional_businessdays("LDN").has_value());
+    }
+    std::filesystem::remove(path);
+}
+
+
+TEST(binary_calendar_source, unsorted_directory) {
+    const auto json = nlohmann::json::parse(R"({
+        "TKY": {"additional_holidays": ["2024-01-01"], "additional_businessdays": []},
+        "NYK": {"additional_holidays": ["2024-07-04"], "additional_businessdays": []}
+    })");
+    const auto src = egret::chrono::json_map_calendar_source(json);
+    const auto codes = std::vector<std::string> {"TKY", "NYK"};
+    const auto path = std::filesystem::temp_directory_path() / "egret_binary_calendar_source_unsorted.bin";
+
+    egret::chrono::write_binary_calendar_snapshot(path, src, codes);
+    {
+        // swap the two directory entries following the 16 bytes header
+        auto bytes = std::vector<char>(std::filesystem::file_size(path));
+        std::ifstream(path, std::ios::binary).read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        std::swap_ranges(bytes.begin() + 16, bytes.begin() + 56, bytes.begin() + 56);
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+    std::filesystem::remove(path);
+}
+TEST(binary_calendar_source, corrupted) {
+    const auto json = nlohmann::json::parse(R"({
+        "TKY": {"additional_holidays": ["2024-01-01", "2024-05-03"], "additional_businessdays": []}
+    })");
+    const auto src = egret::chrono::json_map_calendar_source(json);
+    const auto codes = std::vector<std::string> {"TKY"};
+    const auto path = std::filesystem::temp_directory_path() / "egret_binary_calendar_source_corrupted.bin";
+
+    egret::chrono::write_binary_calendar_snapshot(path, src, codes);
+    auto original = std::vector<char>(std::filesystem::file_size(path));
+    std::ifstream(path, std::ios::binary).read(original.data(), static_cast<std::streamsize>(original.size()));
+    const auto write = [&path](const std::vector<char>& bytes) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+    // overwrite a field of the header or the first directory entry following the 16 bytes header
+    const auto patched = [&original](std::size_t pos, auto value) {
+        auto bytes = original;
+        std::memcpy(bytes.data() + pos, &value, sizeof(value));
+        return bytes;
+    };
+
+    // truncated days
+    write(std::vector<char>(original.begin(), original.end() - 4));
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+
+    // entry count beyond the file
+    write(patched(12, std::uint32_t(0xffffffff)));
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+
+    // offsets wrapping around when the size is added
+    write(patched(16, std::uint64_t(0xffffffffffffffff)));
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+    write(patched(32, std::uint64_t(0xfffffffffffffffc)));
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+    write(patched(40, std::uint64_t(0xfffffffffffffffc)));
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+
+    // counts beyond the file
+    write(patched(28, std::uint32_t(0x40000001)));
+    EXPECT_THROW(egret::chrono::binary_calendar_source {path}, egret::exception);
+
+    write(original);
+    EXPECT_NO_THROW(egret::chrono::binary_calendar_source {path});
+    std::filesystem::remove(path);
+}
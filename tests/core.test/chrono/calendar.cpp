@@ -0,0 +1,202 @@
+#include "core/chrono/calendars/calendar.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    egret::chrono::calendar sample_calendar()
+    {
+        return egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {
+                std::chrono::sys_days(2024y / 1 / 1),
+                std::chrono::sys_days(2024y / 5 / 3),
+                std::chrono::sys_days(2024y / 12 / 31),
+            },
+            {
+                std::chrono::sys_days(2024y / 6 / 1),
+            }
+        );
+    }
+
+// -----------------------------------------------------------------------------
+//  reference_is_holiday
+// -----------------------------------------------------------------------------
+    bool reference_is_holiday(const egret::chrono::calendar& cal, const std::chrono::sys_days& d)
+    {
+        const auto wd = std::chrono::weekday(d);
+        return wd != std::chrono::Saturday && wd != std::chrono::Sunday
+            ?  std::ranges::binary_search(cal.additional_holidays(), d)
+            : !std::ranges::binary_search(cal.additional_businessdays(), d);
+    }
+
+// -----------------------------------------------------------------------------
+//  reference_add_businessdays
+// -----------------------------------------------------------------------------
+    std::chrono::sys_days reference_add_businessdays(const egret::chrono::calendar& cal, std::chrono::sys_days d, int count)
+    {
+        const auto step = std::chrono::days(count < 0 ? -1 : 1);
+        for (auto remained = std::abs(count); remained != 0; ) {
+            d += step;
+            if (!reference_is_holiday(cal, d)) {
+                --remained;
+            }
+        }
+        return d;
+    }
+
+}} // namespace egret::tests
+
+TEST(calendar, is_holiday) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    EXPECT_TRUE(cal.is_holiday(std::chrono::sys_days(2024y / 1 / 1)));
+    EXPECT_TRUE(cal.is_holiday(std::chrono::sys_days(2024y / 5 / 3)));
+    EXPECT_TRUE(cal.is_holiday(std::chrono::sys_days(2024y / 6 / 2)));
+    EXPECT_FALSE(cal.is_holiday(std::chrono::sys_days(2024y / 6 / 1)));
+    EXPECT_FALSE(cal.is_holiday(std::chrono::sys_days(2024y / 1 / 2)));
+    EXPECT_TRUE(cal.is_businessday(std::chrono::sys_days(2024y / 6 / 1)));
+}
+
+TEST(calendar, is_holiday_consistent_with_additional_days) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+
+    // covers dates far beyond the precomputed window as well
+    const auto from = std::chrono::sys_days(1900y / 1 / 1);
+    const auto to = std::chrono::sys_days(2200y / 1 / 1);
+    for (auto d = from; d < to; d += std::chrono::days(1)) {
+        ASSERT_EQ(egret::tests::reference_is_holiday(cal, d), cal.is_holiday(d)) << "date=" << egret::util::to_string(d);
+    }
+}
+
+TEST(calendar, default_calendar) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::chrono::calendar();
+    EXPECT_FALSE(cal.is_holiday(std::chrono::sys_days(2024y / 1 / 1)));
+    EXPECT_TRUE(cal.is_holiday(std::chrono::sys_days(2024y / 1 / 6)));
+    EXPECT_TRUE(cal.is_holiday(std::chrono::sys_days(2024y / 1 / 7)));
+}
+
+TEST(calendar, equality) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto copied = cal;
+    const auto rebuilt = egret::tests::sample_calendar();
+    const auto other = egret::chrono::calendar(
+        cal.identifier(), 
+        {std::chrono::sys_days(2024y / 1 / 1)}, 
+        {std::chrono::sys_days(2024y / 6 / 1)}
+    );
+    EXPECT_EQ(cal, copied);
+    EXPECT_EQ(cal, rebuilt);
+    EXPECT_NE(cal, other);
+    EXPECT_NE(cal, egret::chrono::calendar());
+}
+
+TEST(calendar, count_businessdays) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto from = std::chrono::sys_days(2024y / 4 / 29);
+    const auto to = std::chrono::sys_days(2024y / 6 / 3);
+
+    std::size_t expected = 0;
+    for (auto d = from; d < to; d += std::chrono::days(1)) {
+        expected += egret::tests::reference_is_holiday(cal, d) ? 0 : 1;
+    }
+    EXPECT_EQ(expected, egret::chrono::count_businessdays(cal, from, to));
+    EXPECT_EQ((to - from).count() - expected, egret::chrono::count_holidays(cal, from, to));
+
+    // across the precomputed window
+    const auto far_from = std::chrono::sys_days(1950y / 1 / 1);
+    const auto far_to = std::chrono::sys_days(2150y / 1 / 1);
+    std::size_t far_expected = 0;
+    for (auto d = far_from; d < far_to; d += std::chrono::days(1)) {
+        far_expected += egret::tests::reference_is_holiday(cal, d) ? 0 : 1;
+    }
+    EXPECT_EQ(far_expected, egret::chrono::count_businessdays(cal, far_from, far_to));
+}
+
+TEST(calendar, add_businessdays) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto from = std::chrono::sys_days(2023y / 12 / 1);
+    const auto to = std::chrono::sys_days(2025y / 2 / 1);
+    for (auto d = from; d < to; d += std::chrono::days(1)) {
+        for (const int count : {-260, -11, -2, -1, 0, 1, 2, 11, 260}) {
+            ASSERT_EQ(
+                egret::tests::reference_add_businessdays(cal, d, count),
+                egret::chrono::add_businessdays(cal, d, count)
+            ) << "date=" << egret::util::to_string(d) << ", count=" << count;
+        }
+    }
+}
+
+TEST(calendar, is_holiday_batch) {
+    using namespace std::chrono_literals;
+    for (const auto& cal : {egret::tests::sample_calendar(), egret::chrono::calendar()}) {
+        // dates in and out of the precomputed window, unordered
+        auto ds = std::vector<std::chrono::sys_days>();
+        for (auto d = std::chrono::sys_days(2023y / 12 / 1); d < std::chrono::sys_days(2025y / 2 / 1); d += std::chrono::days(3)) {
+            ds.push_back(d);
+            ds.push_back(d + std::chrono::days(300 * 365));
+            ds.push_back(d - std::chrono::days(300 * 365));
+        }
+        auto hols = std::vector<std::uint64_t>((ds.size() + 63) / 64);
+        auto bds = std::vector<std::uint64_t>(hols.size());
+        cal.is_holiday(ds, hols);
+        cal.is_businessday(ds, bds);
+        for (std::size_t i = 0; i < ds.size(); ++i) {
+            const bool expected = egret::tests::reference_is_holiday(cal, ds[i]);
+            ASSERT_EQ(expected, static_cast<bool>((hols[i / 64] >> (i % 64)) & 1)) << egret::util::to_string(ds[i]);
+            ASSERT_EQ(!expected, static_cast<bool>((bds[i / 64] >> (i % 64)) & 1)) << egret::util::to_string(ds[i]);
+        }
+        if (const auto tail = ds.size() % 64; tail != 0) {
+            EXPECT_EQ(0, hols.back() >> tail);
+            EXPECT_EQ(0, bds.back() >> tail);
+        }
+    }
+}
+
+TEST(calendar, count_businessdays_batch) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    auto froms = std::vector<std::chrono::sys_days>();
+    auto tos = std::vector<std::chrono::sys_days>();
+    for (auto d = std::chrono::sys_days(2023y / 12 / 1); d < std::chrono::sys_days(2025y / 2 / 1); d += std::chrono::days(5)) {
+        froms.push_back(d);
+        tos.push_back(d + std::chrono::days(40));
+        froms.push_back(d);
+        tos.push_back(d + std::chrono::days(200 * 365));
+    }
+    auto result = std::vector<std::size_t>(froms.size());
+    egret::chrono::count_businessdays(cal, froms, tos, result);
+    for (std::size_t i = 0; i < froms.size(); ++i) {
+        EXPECT_EQ(egret::chrono::count_businessdays(cal, froms[i], tos[i]), result[i]);
+    }
+}
+
+TEST(calendar, next_and_prev_businessday) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto windows = {
+        std::pair {std::chrono::sys_days(2023y / 12 / 1), std::chrono::sys_days(2025y / 2 / 1)},
+        std::pair {std::chrono::sys_days(2300y / 1 / 1), std::chrono::sys_days(2300y / 3 / 1)},
+    };
+    for (const auto& [from, to] : windows) {
+        for (auto d = from; d < to; d += std::chrono::days(1)) {
+            auto next = d;
+            while (egret::tests::reference_is_holiday(cal, next)) {
+                next += std::chrono::days(1);
+            }
+            auto prev = d;
+            while (egret::tests::reference_is_holiday(cal, prev)) {
+                prev -= std::chrono::days(1);
+            }
+            ASSERT_EQ(next, egret::chrono::next_businessday(cal, d)) << egret::util::to_string(d);
+            ASSERT_EQ(prev, egret::chrono::prev_businessday(cal, d)) << egret::util::to_string(d);
+        }
+    }
+}
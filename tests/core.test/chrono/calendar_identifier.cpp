@@ -0,0 +1,29 @@
+#include "core/chrono/calendars/calendar_identifier.h"
+
+TEST(calendar_identifier, intern_calendar_code) {
+    const auto id = egret::chrono::intern_calendar_code("TKY");
+    EXPECT_EQ(id, egret::chrono::intern_calendar_code(std::string("TKY")));
+    EXPECT_NE(id, egret::chrono::intern_calendar_code("NYK"));
+}
+
+TEST(calendar_identifier, equality_and_hash) {
+    using egret::chrono::calendar_identifier;
+    using egret::chrono::calendar_combination;
+    using codes_t = std::set<std::string>;
+
+    const auto tky_nyk = calendar_identifier(codes_t {"TKY", "NYK"});
+    const auto nyk_tky = calendar_identifier(codes_t {"NYK", "TKY"}, calendar_combination::all_open);
+    const auto any_open = calendar_identifier(codes_t {"NYK", "TKY"}, calendar_combination::any_open);
+    EXPECT_EQ(tky_nyk, nyk_tky);
+    EXPECT_EQ(tky_nyk.hash(), nyk_tky.hash());
+    EXPECT_NE(tky_nyk, any_open);
+    EXPECT_NE(tky_nyk.hash(), any_open.hash());
+    EXPECT_EQ(std::hash<calendar_identifier>()(tky_nyk), static_cast<std::size_t>(tky_nyk.hash()));
+
+    // combination does not matter for a single calendar
+    const auto tky = calendar_identifier(codes_t {"TKY"});
+    EXPECT_EQ(tky, calendar_identifier(codes_t {"TKY"}, calendar_combination::any_open));
+    EXPECT_EQ(tky.hash(), calendar_identifier(codes_t {"TKY"}, calendar_combination::any_open).hash());
+    EXPECT_NE(tky, calendar_identifier(codes_t {"NYK"}));
+    EXPECT_EQ(calendar_identifier(), calendar_identifier(codes_t {}));
+}
@@ -0,0 +1,127 @@
+#include <nlohmann/json.hpp>
+#include "core/chrono/calendars/calendar_server.h"
+#include "core/chrono/calendars/json_map_calendar_source.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+    using codes_t = std::set<std::string>;
+
+    egret::chrono::json_map_calendar_source<> sample_source(const char* tky_holiday)
+    {
+        auto json = nlohmann::json::parse(R"({
+            "TKY": {
+                "additional_holidays": ["2024-01-01", "2024-01-02"],
+                "additional_businessdays": ["2024-06-01"]
+            },
+            "NYK": {
+                "additional_holidays": ["2024-01-01", "2024-07-04"],
+                "additional_businessdays": ["2024-06-01", "2024-06-08"]
+            }
+        })");
+        json["TKY"]["additional_holidays"].push_back(tky_holiday);
+        return egret::chrono::json_map_calendar_source(json);
+    }
+
+}} // namespace egret::tests
+
+TEST(calendar_server, combination) {
+    using namespace std::chrono_literals;
+    using egret::chrono::calendar_identifier;
+    using egret::chrono::calendar_combination;
+    const auto calsrv = egret::chrono::calendar_server(egret::tests::sample_source("2024-05-03"));
+    const auto keys = std::vector<calendar_identifier> {
+        calendar_identifier(egret::tests::codes_t {"TKY", "NYK"}, calendar_combination::all_open),
+        calendar_identifier(egret::tests::codes_t {"TKY", "NYK"}, calendar_combination::any_open),
+    };
+    calsrv.preload(keys);
+
+    const auto all_open = calsrv.get(keys[0]);
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 1 / 1, 2024y / 1 / 2, 2024y / 5 / 3, 2024y / 7 / 4}), 
+        all_open.additional_holidays()
+    );
+    EXPECT_EQ((std::vector<std::chrono::sys_days> {2024y / 6 / 1}), all_open.additional_businessdays());
+
+    const auto any_open = calsrv.get(keys[1]);
+    EXPECT_EQ((std::vector<std::chrono::sys_days> {2024y / 1 / 1}), any_open.additional_holidays());
+    EXPECT_EQ((std::vector<std::chrono::sys_days> {2024y / 6 / 1, 2024y / 6 / 8}), any_open.additional_businessdays());
+}
+
+TEST(calendar_server, reload) {
+    using namespace std::chrono_literals;
+    using egret::chrono::calendar_identifier;
+    const auto calsrv = egret::chrono::calendar_server(egret::tests::sample_source("2024-05-03"));
+    const auto tky = calendar_identifier(egret::tests::codes_t {"TKY"});
+    const auto nyk = calendar_identifier(egret::tests::codes_t {"NYK"});
+    const auto both = calendar_identifier(egret::tests::codes_t {"TKY", "NYK"});
+
+    const auto old_tky = calsrv.get(tky);
+    const auto old_nyk = calsrv.get(nyk);
+    calsrv.get(both);
+    EXPECT_EQ(0, calsrv.version());
+
+    const auto updated = std::vector<std::string> {"TKY"};
+    calsrv.reload(egret::tests::sample_source("2024-05-06"), updated);
+    EXPECT_EQ(1, calsrv.version());
+
+    // calendars obtained before reload are unchanged
+    EXPECT_TRUE(old_tky.is_holiday(std::chrono::sys_days(2024y / 5 / 3)));
+    EXPECT_FALSE(old_tky.is_holiday(std::chrono::sys_days(2024y / 5 / 6)));
+
+    // dependent calendars are rebuilt
+    EXPECT_FALSE(calsrv.get(tky).is_holiday(std::chrono::sys_days(2024y / 5 / 3)));
+    EXPECT_TRUE(calsrv.get(tky).is_holiday(std::chrono::sys_days(2024y / 5 / 6)));
+    EXPECT_TRUE(calsrv.get(both).is_holiday(std::chrono::sys_days(2024y / 5 / 6)));
+    EXPECT_FALSE(calsrv.get(both).is_holiday(std::chrono::sys_days(2024y / 5 / 3)));
+
+    // others are carried over
+    EXPECT_EQ(old_nyk.additional_holidays().data(), calsrv.get(nyk).additional_holidays().data());
+}
+
+TEST(calendar_server, many_misses) {
+    using namespace std::chrono_literals;
+    using egret::chrono::calendar_identifier;
+    const auto code = [](int i) { return std::format("C{:02}", i); };
+    const auto holiday = [](int i) { return std::chrono::sys_days(2024y / 1 / 1) + std::chrono::days(7 * (i % 4) + i % 5); };
+    auto json = nlohmann::json::object();
+    for (int i = 0; i != 100; ++i) {
+        json[code(i)] = {
+            {"additional_holidays", {std::format("{:%F}", holiday(i))}},
+            {"additional_businessdays", nlohmann::json::array()},
+        };
+    }
+    const auto calsrv = egret::chrono::calendar_server(egret::chrono::json_map_calendar_source(json));
+
+    // each miss is published on top of the calendars cached so far
+    auto calendars = std::vector<egret::chrono::calendar>();
+    for (int i = 0; i != 100; ++i) {
+        calendars.push_back(calsrv.get(calendar_identifier(egret::tests::codes_t {code(i)})));
+    }
+    for (int i = 0; i != 100; ++i) {
+        const auto cal = calsrv.get(calendar_identifier(egret::tests::codes_t {code(i)}));
+        EXPECT_EQ(calendars[i].additional_holidays().data(), cal.additional_holidays().data());
+        EXPECT_TRUE(cal.is_holiday(holiday(i)));
+    }
+
+    auto keys = std::vector<calendar_identifier>();
+    for (int i = 0; i != 100; ++i) {
+        keys.emplace_back(egret::tests::codes_t {code(i), code((i + 1) % 100)});
+    }
+    calsrv.preload(keys);
+    for (int i = 0; i != 100; ++i) {
+        EXPECT_TRUE(calsrv.get(keys[i]).is_holiday(holiday(i)));
+    }
+    EXPECT_EQ(0, calsrv.version());
+
+    // reload keeps calendars not depending on updated codes
+    const auto updated = std::vector<std::string> {code(7)};
+    calsrv.reload(egret::chrono::json_map_calendar_source(json), updated);
+    for (int i = 0; i != 100; ++i) {
+        const auto cal = calsrv.get(calendar_identifier(egret::tests::codes_t {code(i)}));
+        EXPECT_EQ(i != 7, calendars[i].additional_holidays().data() == cal.additional_holidays().data());
+        EXPECT_TRUE(calsrv.get(keys[i]).is_holiday(holiday(i)));
+    }
+}
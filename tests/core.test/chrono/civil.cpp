@@ -0,0 +1,31 @@
+#include "core/chrono/civil.h"
+
+TEST(civil, consistent_with_year_month_day) {
+    using namespace std::chrono_literals;
+    const auto from = std::chrono::sys_days(1600y / 1 / 1);
+    const auto to = std::chrono::sys_days(2400y / 1 / 1);
+    for (auto d = from; d < to; d += std::chrono::days(1)) {
+        const auto ymd = std::chrono::year_month_day(d);
+        const auto c = egret::chrono::to_civil(d);
+        ASSERT_EQ(static_cast<int>(ymd.year()), c.year);
+        ASSERT_EQ(static_cast<unsigned>(ymd.month()), c.month);
+        ASSERT_EQ(static_cast<unsigned>(ymd.day()), c.day);
+        ASSERT_EQ(d, egret::chrono::from_civil(c));
+        ASSERT_EQ(static_cast<unsigned>((ymd.year() / ymd.month() / std::chrono::last).day()), egret::chrono::last_day_of_month(c.year, c.month));
+    }
+}
+
+TEST(civil, add_months) {
+    using namespace std::chrono_literals;
+    const auto from = std::chrono::sys_days(1999y / 1 / 1);
+    const auto to = std::chrono::sys_days(2001y / 1 / 1);
+    for (auto d = from; d < to; d += std::chrono::days(1)) {
+        for (const int m : {-25, -12, -1, 0, 1, 2, 11, 12, 13, 120}) {
+            // day overflow is the same as std::chrono
+            ASSERT_EQ(
+                std::chrono::sys_days(std::chrono::year_month_day(d) + std::chrono::months(m)), 
+                egret::chrono::add_months(d, m)
+            );
+        }
+    }
+}
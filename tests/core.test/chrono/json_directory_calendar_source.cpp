@@ -0,0 +1,87 @@
+#include <fstream>
+#include <thread>
+#include "core/chrono/calendars/json_directory_calendar_source.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+    using days_t = std::vector<std::chrono::sys_days>;
+
+    // write {code}.json and move its timestamp forward, so that a rewrite is detected regardless of the file system resolution
+    void write_calendar(const std::filesystem::path& dirpath, const std::string& code, const char* holiday)
+    {
+        const auto path = dirpath / (code + ".json");
+        const auto exists = std::filesystem::exists(path);
+        const auto timestamp = exists ? std::filesystem::last_write_time(path) : std::filesystem::file_time_type();
+        std::ofstream(path, std::ios::trunc) << std::format(
+            R"({{"additional_holidays": ["{}"], "additional_businessdays": []}})", holiday
+        );
+        if (exists) {
+            std::filesystem::last_write_time(path, timestamp + 2s);
+        }
+    }
+
+    std::filesystem::path make_directory(const char* name)
+    {
+        const auto dirpath = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(dirpath);
+        std::filesystem::create_directories(dirpath);
+        return dirpath;
+    }
+
+}} // namespace egret::tests
+
+TEST(json_directory_calendar_source, check_interval) {
+    using namespace std::chrono_literals;
+    const auto dirpath = egret::tests::make_directory("egret_json_directory_calendar_source_interval");
+    egret::tests::write_calendar(dirpath, "TKY", "2024-05-03");
+    const auto src = egret::chrono::json_directory_calendar_source(dirpath, ".json", std::chrono::seconds(1));
+
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 3}, src.get_additional_holidays("TKY"));
+    EXPECT_EQ(egret::tests::days_t {}, src.get_additional_businessdays("TKY"));
+    EXPECT_FALSE(src.get_additional_holidays("LDN").has_value());
+
+    // changes are not seen until check_interval elapses
+    egret::tests::write_calendar(dirpath, "TKY", "2024-05-06");
+    egret::tests::write_calendar(dirpath, "LDN", "2024-05-27");
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 3}, src.get_additional_holidays("TKY"));
+    EXPECT_FALSE(src.get_additional_holidays("LDN").has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 6}, src.get_additional_holidays("TKY"));
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 27}, src.get_additional_holidays("LDN"));
+
+    // a removed file is reported as missing once checked again
+    std::filesystem::remove(dirpath / "LDN.json");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_FALSE(src.get_additional_holidays("LDN").has_value());
+    EXPECT_FALSE(src.get_additional_businessdays("LDN").has_value());
+
+    std::filesystem::remove_all(dirpath);
+}
+
+TEST(json_directory_calendar_source, no_check) {
+    using namespace std::chrono_literals;
+    const auto dirpath = egret::tests::make_directory("egret_json_directory_calendar_source_no_check");
+    egret::tests::write_calendar(dirpath, "TKY", "2024-05-03");
+    const auto src = egret::chrono::json_directory_calendar_source(dirpath, ".json", std::nullopt);
+
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 3}, src.get_additional_holidays("TKY"));
+    EXPECT_FALSE(src.get_additional_holidays("LDN").has_value());
+
+    // cached days and cached missing files are kept for good
+    egret::tests::write_calendar(dirpath, "TKY", "2024-05-06");
+    egret::tests::write_calendar(dirpath, "LDN", "2024-05-27");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 3}, src.get_additional_holidays("TKY"));
+    EXPECT_FALSE(src.get_additional_holidays("LDN").has_value());
+
+    // a fresh source reads the current files
+    const auto fresh = egret::chrono::json_directory_calendar_source(dirpath);
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 6}, fresh.get_additional_holidays("TKY"));
+    EXPECT_EQ(egret::tests::days_t {2024y / 5 / 27}, fresh.get_additional_holidays("LDN"));
+
+    std::filesystem::remove_all(dirpath);
+}
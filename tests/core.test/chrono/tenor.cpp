@@ -0,0 +1,17 @@
+#include "core/chrono/tenor.h"
+
+TEST(tenor, add_tenors) {
+    using namespace std::chrono_literals;
+    using egret::chrono::tenor;
+    const auto refs = std::vector<std::chrono::sys_days> {2024y / 1 / 31, 2024y / 2 / 29, 2023y / 12 / 15};
+    const auto tenors = std::vector<tenor> {
+        tenor::days(1), tenor::weeks(2), tenor::months(1), tenor::months(-3), tenor::years(1), tenor::years(50),
+    };
+    auto result = std::vector<std::chrono::sys_days>(refs.size() * tenors.size());
+    egret::chrono::add_tenors(refs, tenors, result);
+    for (std::size_t i = 0; i < refs.size(); ++i) {
+        for (std::size_t j = 0; j < tenors.size(); ++j) {
+            EXPECT_EQ(refs[i] + tenors[j], result[i * tenors.size() + j]);
+        }
+    }
+}
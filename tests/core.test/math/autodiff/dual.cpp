@@ -0,0 +1,196 @@
+#include <cmath>
+#include <vector>
+#include "core/math/algebra/concepts.h"
+#include "core/math/autodiff/dual.h"
+#include "core/math/interp1d/cspline.h"
+#include "core/math/interp1d/linear.h"
+#include "core/math/interp1d/slopes/central_difference.h"
+
+namespace egret::tests { namespace {
+    using egret::math::autodiff::dual;
+
+    constexpr double bump = 1e-6;
+
+    void expect_dual(const dual<double>& x, double value, std::vector<double> gradient)
+    {
+        EXPECT_NEAR(x.value(), value, 1e-12);
+        for (std::size_t i = 0; i != gradient.size(); ++i) {
+            EXPECT_NEAR(x.derivative(i), gradient[i], 1e-12) << "i=" << i;
+        }
+    }
+
+    // compares derivatives of f with respect to ys with central differences
+    template <typename F>
+    void expect_knot_gradient(const F& f, const std::vector<double>& ys, const std::vector<double>& qs)
+    {
+        const auto vars = egret::math::autodiff::variables(std::span<const double>(ys));
+        for (const double q : qs) {
+            const dual<double> result = f(vars, q);
+            for (std::size_t i = 0; i != ys.size(); ++i) {
+                auto up = ys;
+                auto dn = ys;
+                up[i] += bump;
+                dn[i] -= bump;
+                const double fd = (f(up, q) - f(dn, q)) / (2. * bump);
+                EXPECT_NEAR(result.derivative(i), fd, 1e-7) << "q=" << q << ", i=" << i;
+            }
+        }
+    }
+
+}} // namespace egret::tests
+
+TEST(dual, concepts) {
+    using egret::math::autodiff::dual;
+    static_assert(egret::cpt::additive_group<double>);
+    static_assert(egret::cpt::additive_group<dual<double>>);
+    static_assert(egret::cpt::additive_group<dual<double, 2>>);
+    static_assert(egret::cpt::strict_vector<dual<double>, double>);
+    static_assert(egret::cpt::strict_vector<dual<double, 2>, double>);
+    static_assert(!egret::cpt::additive_group<std::vector<double>>);
+}
+
+TEST(dual, constants) {
+    using egret::math::autodiff::dual;
+    const auto c = dual<double>(2.);
+    EXPECT_EQ(c.size(), 0);
+    EXPECT_EQ(c.derivative(3), 0.);
+
+    const auto x = dual<double>::variable(3., 1, 2);
+    egret::tests::expect_dual(c * x + c, 8., {0., 2.});
+    EXPECT_THROW(dual<double>::variable(1., 2, 2), std::exception);
+}
+
+TEST(dual, arithmetic) {
+    using egret::math::autodiff::dual;
+    const auto x = dual<double>::variable(3., 0, 2);
+    const auto y = dual<double>::variable(2., 1, 2);
+
+    egret::tests::expect_dual(+x, 3., {1., 0.});
+    egret::tests::expect_dual(-x, -3., {-1., 0.});
+    egret::tests::expect_dual(x + y, 5., {1., 1.});
+    egret::tests::expect_dual(x - y, 1., {1., -1.});
+    egret::tests::expect_dual(x * y, 6., {2., 3.});
+    egret::tests::expect_dual(x / y, 1.5, {0.5, -0.75});
+
+    egret::tests::expect_dual(x + 2., 5., {1., 0.});
+    egret::tests::expect_dual(2. + x, 5., {1., 0.});
+    egret::tests::expect_dual(x - 2., 1., {1., 0.});
+    egret::tests::expect_dual(2. - x, -1., {-1., 0.});
+    egret::tests::expect_dual(x * 2., 6., {2., 0.});
+    egret::tests::expect_dual(2. * x, 6., {2., 0.});
+    egret::tests::expect_dual(x / 2., 1.5, {0.5, 0.});
+    egret::tests::expect_dual(2. / x, 2. / 3., {-2. / 9., 0.});
+
+    auto z = x;
+    z += y;
+    egret::tests::expect_dual(z, 5., {1., 1.});
+    z -= y;
+    egret::tests::expect_dual(z, 3., {1., 0.});
+    z *= y;
+    egret::tests::expect_dual(z, 6., {2., 3.});
+    z /= y;
+    egret::tests::expect_dual(z, 3., {1., 0.});
+
+    EXPECT_TRUE(x > y);
+    EXPECT_TRUE(x == 3.);
+}
+
+TEST(dual, compound_assignment_aliasing) {
+    using egret::math::autodiff::dual;
+    {
+        auto y = dual<double>::variable(3., 0, 1);
+        y += y;
+        egret::tests::expect_dual(y, 6., {2.});
+    }
+    {
+        auto y = dual<double>::variable(3., 0, 1);
+        y -= y;
+        egret::tests::expect_dual(y, 0., {0.});
+    }
+    {
+        auto y = dual<double>::variable(3., 0, 1);
+        y *= y;
+        egret::tests::expect_dual(y, 9., {6.});
+    }
+    {
+        auto y = dual<double>::variable(3., 0, 1);
+        y /= y;
+        egret::tests::expect_dual(y, 1., {0.});
+    }
+    {
+        auto y = dual<double, 1>::variable(3., 0);
+        y *= y;
+        EXPECT_EQ(y.value(), 9.);
+        EXPECT_EQ(y.derivative(0), 6.);
+    }
+}
+
+TEST(dual, elementary_functions) {
+    using egret::math::autodiff::dual;
+    const auto x = dual<double>::variable(1.5, 0, 1);
+    egret::tests::expect_dual(exp(x), std::exp(1.5), {std::exp(1.5)});
+    egret::tests::expect_dual(log(x), std::log(1.5), {1. / 1.5});
+    egret::tests::expect_dual(sqrt(x), std::sqrt(1.5), {0.5 / std::sqrt(1.5)});
+    egret::tests::expect_dual(pow(x, 2.5), std::pow(1.5, 2.5), {2.5 * std::pow(1.5, 1.5)});
+    egret::tests::expect_dual(pow(x, -1.), 1. / 1.5, {-1. / (1.5 * 1.5)});
+    egret::tests::expect_dual(abs(x), 1.5, {1.});
+    egret::tests::expect_dual(abs(-x), 1.5, {1.});
+    egret::tests::expect_dual(abs(x - 2.), 0.5, {-1.});
+}
+
+TEST(dual, pow_at_zero) {
+    using egret::math::autodiff::dual;
+    const auto x = dual<double>::variable(0., 0, 1);
+    const auto half = pow(x, 0.5);
+    EXPECT_EQ(half.value(), 0.);
+    EXPECT_TRUE(std::isinf(half.derivative(0)));
+    egret::tests::expect_dual(pow(x, 0.), 1., {0.});
+    egret::tests::expect_dual(pow(x, 1.), 0., {1.});
+    egret::tests::expect_dual(pow(x, 2.), 0., {0.});
+    egret::tests::expect_dual(pow(x, 3.), 0., {0.});
+}
+
+TEST(dual, boundary_keeps_other_variables) {
+    using egret::math::autodiff::dual;
+    // x depends only on the first of three variables, and is at the boundary of sqrt and pow
+    const auto u = dual<double>::variable(2., 0, 3);
+    const auto v = dual<double>::variable(1., 1, 3);
+    const auto x = u - 2.;
+    const auto expect_other_variables = [&v](const dual<double>& y, const char* name) {
+        EXPECT_TRUE(std::isinf(y.derivative(0))) << name;
+        EXPECT_EQ(y.derivative(1), 0.) << name;
+        EXPECT_EQ(y.derivative(2), 0.) << name;
+        const auto z = y + v;
+        EXPECT_EQ(z.derivative(1), 1.) << name;
+        EXPECT_FALSE(std::isnan(z.derivative(2))) << name;
+    };
+    expect_other_variables(sqrt(x), "sqrt");
+    expect_other_variables(pow(x, 0.5), "pow");
+    expect_other_variables(log(x), "log");
+
+    // static extent behaves the same
+    const auto w = dual<double, 2>::variable(0., 0);
+    const auto y = sqrt(w);
+    EXPECT_TRUE(std::isinf(y.derivative(0)));
+    EXPECT_EQ(y.derivative(1), 0.);
+}
+
+TEST(dual, linear_knot_gradient) {
+    namespace interp1d = egret::math::interp1d;
+    const auto xs = std::vector<double> {0., 0.5, 1., 2., 5.};
+    const auto ys = std::vector<double> {0.01, 0.012, 0.015, 0.02, 0.018};
+    const auto f = [&xs]<typename Y>(const std::vector<Y>& values, double q) {
+        return interp1d::generic_linear(xs, values)(q);
+    };
+    egret::tests::expect_knot_gradient(f, ys, {-0.5, 0., 0.25, 0.75, 1.5, 2., 4.9, 6.});
+}
+
+TEST(dual, cspline_knot_gradient) {
+    namespace interp1d = egret::math::interp1d;
+    const auto xs = std::vector<double> {0., 0.5, 1., 2., 5.};
+    const auto ys = std::vector<double> {0.01, 0.012, 0.015, 0.02, 0.018};
+    const auto f = [&xs]<typename Y>(const std::vector<Y>& values, double q) {
+        return interp1d::cspline(xs, values, interp1d::central_difference {})(q);
+    };
+    egret::tests::expect_knot_gradient(f, ys, {0., 0.25, 0.75, 1.5, 2., 4.9});
+}
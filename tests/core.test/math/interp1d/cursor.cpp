@@ -0,0 +1,129 @@
+#include <random>
+#include <vector>
+#include "core/math/interp1d/any.h"
+#include "core/math/interp1d/cspline.h"
+#include "core/math/interp1d/cursor.h"
+#include "core/math/interp1d/linear.h"
+#include "core/math/interp1d/pwconst.h"
+#include "core/math/interp1d/slopes/central_difference.h"
+
+namespace egret::tests { namespace {
+    const auto grids = std::vector<double> {0., 0.5, 1., 2., 3., 5., 7., 10., 15., 20., 30.};
+    const auto values = std::vector<double> {0.01, 0.012, 0.015, 0.017, 0.02, 0.021, 0.019, 0.022, 0.023, 0.024, 0.025};
+
+    // ascending steps followed by random jumps and points outside the grids
+    std::vector<double> queries()
+    {
+        auto result = std::vector<double> {};
+        for (double x = -1.; x < 32.; x += 0.25) {
+            result.push_back(x);
+        }
+        auto rng = std::mt19937_64(20240604);
+        auto dist = std::uniform_real_distribution<double>(-2., 32.);
+        for (std::size_t i = 0; i != 100; ++i) {
+            result.push_back(dist(rng));
+        }
+        return result;
+    }
+
+    template <typename F>
+    void expect_hinted_calls_agree(const F& f)
+    {
+        auto c = egret::math::interp1d::cursor(f);
+        auto hint = egret::math::interp1d::interval_hint {};
+        for (const double x : queries()) {
+            EXPECT_DOUBLE_EQ(c(x), f(x)) << "x=" << x;
+            EXPECT_DOUBLE_EQ(f(x, hint), f(x)) << "x=" << x;
+            if constexpr (requires { f.der1(x); }) {
+                EXPECT_DOUBLE_EQ(c.der1(x), f.der1(x)) << "x=" << x;
+            }
+            if constexpr (requires { f.der2(x); }) {
+                EXPECT_DOUBLE_EQ(c.der2(x), f.der2(x)) << "x=" << x;
+            }
+        }
+    }
+
+}} // namespace egret::tests
+
+TEST(cursor, linear) {
+    using namespace egret::tests;
+    expect_hinted_calls_agree(egret::math::interp1d::generic_linear(grids, values));
+}
+
+TEST(cursor, cspline) {
+    using namespace egret::tests;
+    expect_hinted_calls_agree(egret::math::interp1d::cspline(grids, values, egret::math::interp1d::central_difference {}));
+}
+
+TEST(cursor, pwconst) {
+    using namespace egret::tests;
+    expect_hinted_calls_agree(egret::math::interp1d::generic_pwconst(grids, values, 0.5));
+}
+
+TEST(cursor, hinted_derivatives) {
+    using namespace egret::tests;
+    const auto f = egret::math::interp1d::cspline(grids, values, egret::math::interp1d::central_difference {});
+    auto hint1 = egret::math::interp1d::interval_hint {};
+    auto hint2 = egret::math::interp1d::interval_hint {};
+    for (const double x : queries()) {
+        EXPECT_DOUBLE_EQ(f.der1(x, hint1), f.der1(x)) << "x=" << x;
+        EXPECT_DOUBLE_EQ(f.der2(x, hint2), f.der2(x)) << "x=" << x;
+        EXPECT_EQ(hint1.index, hint2.index) << "x=" << x;
+    }
+    const auto g = egret::math::interp1d::generic_linear(grids, values);
+    auto hint = egret::math::interp1d::interval_hint {};
+    for (const double x : queries()) {
+        EXPECT_DOUBLE_EQ(g.der1(x, hint), g.der1(x)) << "x=" << x;
+    }
+}
+
+TEST(cursor, stale_hint) {
+    using namespace egret::tests;
+    const auto f = egret::math::interp1d::generic_linear(grids, values);
+    for (const std::ptrdiff_t index : {std::ptrdiff_t(-5), std::ptrdiff_t(0), std::ptrdiff_t(9), std::ptrdiff_t(100)}) {
+        for (const double x : {-1., 0., 2.5, 30., 40.}) {
+            auto hint = egret::math::interp1d::interval_hint {index};
+            EXPECT_DOUBLE_EQ(f(x, hint), f(x)) << "x=" << x << ", hint=" << index;
+            EXPECT_GE(hint.index, 0);
+            EXPECT_LE(hint.index, static_cast<std::ptrdiff_t>(grids.size()) - 2);
+        }
+    }
+
+    // a cursor moved to a shorter interpolation keeps working from its clamped hint
+    const auto short_f = egret::math::interp1d::generic_linear(std::vector<double> {0., 1., 2.}, std::vector<double> {0., 1., 4.});
+    auto hint = egret::math::interp1d::interval_hint {};
+    static_cast<void>(f(25., hint));
+    EXPECT_DOUBLE_EQ(short_f(1.5, hint), 2.5);
+    EXPECT_EQ(hint.index, 1);
+}
+
+TEST(cursor, reset) {
+    using namespace egret::tests;
+    const auto f = egret::math::interp1d::generic_linear(grids, values);
+    auto c = egret::math::interp1d::cursor(f);
+    static_cast<void>(c(25.));
+    EXPECT_EQ(c.hint().index, 9);
+    c.reset();
+    EXPECT_EQ(c.hint().index, 0);
+    EXPECT_EQ(&c.function(), &f);
+}
+
+TEST(cursor, any) {
+    using namespace egret::tests;
+    const auto f = egret::math::interp1d::any<double, double>(
+        egret::math::interp1d::cspline(grids, values, egret::math::interp1d::central_difference {})
+    );
+    expect_hinted_calls_agree(f);
+
+    auto hint = egret::math::interp1d::interval_hint {};
+    for (const double x : queries()) {
+        EXPECT_DOUBLE_EQ(f.der1(x, hint), f.der1(x)) << "x=" << x;
+        EXPECT_DOUBLE_EQ(f.der2(x, hint), f.der2(x)) << "x=" << x;
+    }
+
+    // der1 and der2 of pwconst have no hinted overloads, and any falls back to the plain ones
+    const auto g = egret::math::interp1d::any<double, double>(egret::math::interp1d::generic_pwconst(grids, values, 0.5));
+    expect_hinted_calls_agree(g);
+    auto stale = egret::math::interp1d::interval_hint {7};
+    EXPECT_DOUBLE_EQ(g.der1(1.5, stale), 0.);
+}
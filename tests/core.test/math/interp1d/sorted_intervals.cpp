@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "core/math/interp1d/cspline.h"
+#include "core/math/interp1d/linear.h"
+#include "core/math/interp1d/pwconst.h"
+#include "core/math/interp1d/slopes/central_difference.h"
+
+namespace egret::tests { namespace {
+    const auto grids = std::vector<double> {0., 0.5, 1., 2., 3., 5., 7., 10., 15., 20., 30.};
+    const auto values = std::vector<double> {0.01, 0.012, 0.015, 0.017, 0.02, 0.021, 0.019, 0.022, 0.023, 0.024, 0.025};
+
+    // queries on knots, inside intervals, and outside the grids
+    std::vector<double> sorted_queries()
+    {
+        auto result = std::vector<double> {-1., 30., 31.};
+        result.insert(result.end(), grids.begin(), grids.end());
+        auto rng = std::mt19937_64(20240601);
+        auto dist = std::uniform_real_distribution<double>(-0.5, 32.);
+        for (std::size_t i = 0; i != 200; ++i) {
+            result.push_back(dist(rng));
+        }
+        std::ranges::sort(result);
+        return result;
+    }
+
+    // ascending runs, long jumps back and forth and repeated queries
+    std::vector<double> unsorted_queries()
+    {
+        auto result = sorted_queries();
+        auto rng = std::mt19937_64(20240602);
+        std::ranges::shuffle(result.begin() + result.size() / 2, result.end(), rng);
+        result.insert(result.end(), {25., 0.1, 0.1, 29., -2., 1.5});
+        return result;
+    }
+
+    template <typename F>
+    void expect_batches_agree(const F& f, const std::vector<double>& qs)
+    {
+        auto values = std::vector<double> {};
+        auto der1s = std::vector<double> {};
+        auto der2s = std::vector<double> {};
+        f.evaluate_sorted(qs, std::back_inserter(values));
+        f.der1_sorted(qs, std::back_inserter(der1s));
+        f.der2_sorted(qs, std::back_inserter(der2s));
+        ASSERT_EQ(values.size(), qs.size());
+        ASSERT_EQ(der1s.size(), qs.size());
+        ASSERT_EQ(der2s.size(), qs.size());
+        for (std::size_t i = 0; i != qs.size(); ++i) {
+            EXPECT_DOUBLE_EQ(values[i], f(qs[i])) << "x=" << qs[i];
+            EXPECT_DOUBLE_EQ(der1s[i], f.der1(qs[i])) << "x=" << qs[i];
+            EXPECT_DOUBLE_EQ(der2s[i], f.der2(qs[i])) << "x=" << qs[i];
+        }
+    }
+
+}} // namespace egret::tests
+
+TEST(sorted_intervals, linear) {
+    using namespace egret::tests;
+    const auto f = egret::math::interp1d::generic_linear(grids, values);
+    expect_batches_agree(f, sorted_queries());
+    expect_batches_agree(f, unsorted_queries());
+}
+
+TEST(sorted_intervals, cspline) {
+    using namespace egret::tests;
+    const auto f = egret::math::interp1d::cspline(grids, values, egret::math::interp1d::central_difference {});
+    expect_batches_agree(f, sorted_queries());
+    expect_batches_agree(f, unsorted_queries());
+}
+
+TEST(sorted_intervals, pwconst) {
+    using namespace egret::tests;
+    for (const bool is_right_continuous : {true, false}) {
+        const auto f = egret::math::interp1d::generic_pwconst(grids, values, 0.5, is_right_continuous);
+        expect_batches_agree(f, sorted_queries());
+        expect_batches_agree(f, unsorted_queries());
+    }
+}
+
+TEST(sorted_intervals, two_grids) {
+    const auto f = egret::math::interp1d::generic_linear(std::vector<double> {0., 1.}, std::vector<double> {1., 2.});
+    auto out = std::vector<double> {};
+    f.evaluate_sorted(std::vector<double> {-1., 0.5, 2.}, std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<double> {0., 1.5, 3.}));
+}
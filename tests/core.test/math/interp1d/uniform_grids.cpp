@@ -0,0 +1,102 @@
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "core/math/interp1d/linear.h"
+#include "core/math/interp1d/uniform_grids.h"
+#include "core/utils/range_utils/find_interval.h"
+
+namespace egret::tests { namespace {
+    // every knot, points next to knots, and points outside the grids
+    std::vector<double> sample_queries(const std::vector<double>& grids)
+    {
+        const double step = grids[1] - grids[0];
+        auto result = std::vector<double> {grids.front() - step, grids.back() + step, grids.back() + 100. * step};
+        for (const double x : grids) {
+            result.push_back(x);
+            result.push_back(std::nextafter(x, -1e300));
+            result.push_back(std::nextafter(x, 1e300));
+            result.push_back(x + 0.5 * step);
+        }
+        return result;
+    }
+
+    void expect_agree_with_find_interval(const egret::math::interp1d::uniform_grids<double>& uniform)
+    {
+        const auto& grids = uniform.get();
+        for (const double x : sample_queries(grids)) {
+            const auto expected = egret::util::find_interval(grids, x).first - grids.begin();
+            const auto actual = egret::util::find_interval(uniform, x);
+            EXPECT_EQ(actual.first - uniform.begin(), expected) << "x=" << x;
+            EXPECT_EQ(actual.second, std::ranges::next(actual.first));
+        }
+    }
+
+}} // namespace egret::tests
+
+TEST(uniform_grids, find_interval) {
+    // steps which are not exact in binary, so that grids are rounded
+    for (const double step : {0.1, 1. / 3., 1. / 365., 0.25, 7.}) {
+        for (const std::size_t n : {2, 3, 10, 365, 1000}) {
+            egret::tests::expect_agree_with_find_interval(egret::math::interp1d::uniform_grids(0.3, step, n));
+            egret::tests::expect_agree_with_find_interval(egret::math::interp1d::uniform_grids(-5., step, n));
+        }
+    }
+}
+
+TEST(uniform_grids, find_interval_on_perturbed_grids) {
+    // grids detected as uniform within the tolerance, whose arithmetic index needs correction
+    for (const double tolerance : {1e-8, 0.1, 0.45}) {
+        auto rng = std::mt19937_64(20240606);
+        auto dist = std::uniform_real_distribution<double>(-tolerance / 2., tolerance / 2.);
+        auto grids = std::vector<double>(50);
+        for (std::size_t i = 0; i != grids.size(); ++i) {
+            grids[i] = static_cast<double>(i) + (i < 2 ? 0. : dist(rng));
+        }
+        egret::tests::expect_agree_with_find_interval(egret::math::interp1d::uniform_grids(grids, tolerance));
+    }
+}
+
+TEST(uniform_grids, sys_days) {
+    using namespace std::chrono_literals;
+    const auto first = std::chrono::sys_days(2024y / 1 / 1);
+    const auto uniform = egret::math::interp1d::uniform_grids(first, std::chrono::days(1), 366);
+    const auto& grids = uniform.get();
+    EXPECT_EQ(uniform.back(), std::chrono::sys_days(2024y / 12 / 31));
+    for (auto d = first - std::chrono::days(3); d <= uniform.back() + std::chrono::days(3); d += std::chrono::days(1)) {
+        const auto expected = egret::util::find_interval(grids, d).first - grids.begin();
+        EXPECT_EQ(egret::util::find_interval(uniform, d).first - uniform.begin(), expected);
+    }
+}
+
+TEST(uniform_grids, interpolation) {
+    namespace interp1d = egret::math::interp1d;
+    const auto uniform = interp1d::uniform_grids(0., 0.1, 11);
+    auto ys = std::vector<double>(11);
+    for (std::size_t i = 0; i != ys.size(); ++i) {
+        ys[i] = static_cast<double>(i * i);
+    }
+    const auto f = interp1d::generic_linear(uniform, ys);
+    const auto g = interp1d::generic_linear(uniform.get(), ys);
+    for (const double x : egret::tests::sample_queries(uniform.get())) {
+        EXPECT_EQ(f(x), g(x)) << "x=" << x;
+    }
+}
+
+TEST(uniform_grids, validation) {
+    namespace interp1d = egret::math::interp1d;
+    EXPECT_TRUE(interp1d::is_uniform(std::vector<double> {0., 0.5, 1.}));
+    EXPECT_FALSE(interp1d::is_uniform(std::vector<double> {0., 0.5, 1.1}));
+    EXPECT_FALSE(interp1d::is_uniform(std::vector<double> {0.}));
+    EXPECT_FALSE(interp1d::is_uniform(std::vector<double> {1., 1.}));
+
+    EXPECT_THROW(interp1d::uniform_grids(std::vector<double> {0., 0.5, 1.1}), std::exception);
+    EXPECT_THROW(interp1d::uniform_grids(std::vector<double> {0., 1., 2.}, 0.5), std::exception);
+    EXPECT_THROW(interp1d::uniform_grids(std::vector<double> {0., 1., 2.}, -0.1), std::exception);
+    EXPECT_DOUBLE_EQ(interp1d::uniform_grids(std::vector<double> {0., 0.5, 1.}).step(), 0.5);
+
+    EXPECT_THROW(interp1d::uniform_grids(0., 0., 3), std::exception);
+    EXPECT_THROW(interp1d::uniform_grids(1., -0.5, 3), std::exception);
+    EXPECT_THROW(interp1d::uniform_grids(0., std::nan(""), 3), std::exception);
+    EXPECT_THROW(interp1d::uniform_grids(std::chrono::sys_days(), std::chrono::days(-1), 3), std::exception);
+}
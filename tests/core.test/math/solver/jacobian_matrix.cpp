@@ -0,0 +1,134 @@
+#include <cmath>
+#include <vector>
+#include "core/math/solver/jacobian_matrix.h"
+
+namespace egret::tests { namespace {
+    using egret::math::solver::band_width;
+    using egret::math::solver::jacobian_matrix;
+
+    std::vector<double> multiply(const std::vector<std::vector<double>>& a, const std::vector<double>& x)
+    {
+        auto result = std::vector<double>(a.size(), 0.);
+        for (std::size_t i = 0; i != a.size(); ++i) {
+            for (std::size_t j = 0; j != x.size(); ++j) {
+                result[i] += a[i][j] * x[j];
+            }
+        }
+        return result;
+    }
+
+    // tridiagonal matrix whose first diagonal element is zero, so that the first column needs row pivoting
+    std::vector<std::vector<double>> tridiagonal(std::size_t n)
+    {
+        auto result = std::vector<std::vector<double>>(n, std::vector<double>(n, 0.));
+        for (std::size_t i = 0; i != n; ++i) {
+            result[i][i] = i == 0 ? 0. : 2. + 0.1 * static_cast<double>(i);
+            if (i != 0) {
+                result[i][i - 1] = 3. - 0.2 * static_cast<double>(i);
+            }
+            if (i + 1 != n) {
+                result[i][i + 1] = -1. + 0.05 * static_cast<double>(i);
+            }
+        }
+        return result;
+    }
+
+}} // namespace egret::tests
+
+TEST(jacobian_matrix, dense_lu_solve) {
+    using namespace egret::tests;
+    const auto a = std::vector<std::vector<double>> {
+        {0., 2., 1.},
+        {1., 1., 1.},
+        {2., 1., 0.},
+    };
+    const auto x = std::vector<double> {1., 2., 3.};
+    auto m = jacobian_matrix<double>(3, 3);
+    for (std::size_t i = 0; i != 3; ++i) {
+        for (std::size_t j = 0; j != 3; ++j) {
+            m(i, j) = a[i][j];
+        }
+    }
+    auto pivots = std::vector<std::size_t> {};
+    ASSERT_TRUE(m.lu_decompose(pivots));
+    EXPECT_NE(pivots[0], 0);
+
+    auto b = multiply(a, x);
+    m.lu_solve(pivots, b);
+    for (std::size_t i = 0; i != 3; ++i) {
+        EXPECT_NEAR(b[i], x[i], 1e-14);
+    }
+}
+
+TEST(jacobian_matrix, banded_lu_solve_agrees_with_dense) {
+    using namespace egret::tests;
+    constexpr std::size_t n = 8;
+    const auto a = tridiagonal(n);
+    auto x = std::vector<double>(n);
+    for (std::size_t i = 0; i != n; ++i) {
+        x[i] = 1. + 0.5 * static_cast<double>(i);
+    }
+
+    auto dense = jacobian_matrix<double>(n, n);
+    auto banded = jacobian_matrix<double>(n, band_width {1, 1});
+    for (std::size_t i = 0; i != n; ++i) {
+        const auto [first, last] = banded.row_range(i);
+        for (std::size_t j = first; j != last; ++j) {
+            banded(i, j) = a[i][j];
+        }
+        for (std::size_t j = 0; j != n; ++j) {
+            dense(i, j) = a[i][j];
+        }
+    }
+    auto dense_pivots = std::vector<std::size_t> {};
+    auto banded_pivots = std::vector<std::size_t> {};
+    ASSERT_TRUE(dense.lu_decompose(dense_pivots));
+    ASSERT_TRUE(banded.lu_decompose(banded_pivots));
+    EXPECT_EQ(dense_pivots, banded_pivots);
+    EXPECT_NE(banded_pivots[0], 0);
+
+    auto dense_b = multiply(a, x);
+    auto banded_b = dense_b;
+    dense.lu_solve(dense_pivots, dense_b);
+    banded.lu_solve(banded_pivots, banded_b);
+    for (std::size_t i = 0; i != n; ++i) {
+        EXPECT_NEAR(dense_b[i], x[i], 1e-12);
+        EXPECT_NEAR(banded_b[i], x[i], 1e-12);
+    }
+}
+
+TEST(jacobian_matrix, singular) {
+    using egret::math::solver::band_width;
+    using egret::math::solver::jacobian_matrix;
+    auto dense = jacobian_matrix<double>(2, 2);
+    dense(0, 0) = 1.;
+    dense(0, 1) = 2.;
+    dense(1, 0) = 2.;
+    dense(1, 1) = 4.;
+    auto pivots = std::vector<std::size_t> {};
+    EXPECT_FALSE(dense.lu_decompose(pivots));
+
+    auto banded = jacobian_matrix<double>(3, band_width {1, 0});
+    banded(0, 0) = 1.;
+    banded(1, 0) = 1.;
+    banded(2, 1) = 1.;
+    EXPECT_FALSE(banded.lu_decompose(pivots));
+}
+
+TEST(jacobian_matrix, banded_access_outside_band) {
+    using namespace egret::tests;
+    auto jac = jacobian_matrix<double>(6, band_width {.lower = 1, .upper = 1});
+
+    // the stored band covers the lower extra super diagonal for pivoting
+    jac(3, 2) = 1.;
+    jac(3, 5) = 1.;
+    jac(0, 2) = 1.;
+    EXPECT_EQ(1., jac(3, 2));
+    EXPECT_EQ(1., jac(3, 5));
+    EXPECT_EQ(1., jac(0, 2));
+    if constexpr (egret::config::is_debug_mode) {
+        EXPECT_THROW(jac(3, 1), egret::exception);
+        EXPECT_THROW(jac(2, 5), egret::exception);
+        EXPECT_THROW(jac(6, 5), egret::exception);
+    }
+}
@@ -0,0 +1,180 @@
+#include <cmath>
+#include <optional>
+#include <span>
+#include <vector>
+#include "core/math/solver/newton_nd.h"
+
+namespace egret::tests { namespace {
+    using egret::math::solver::band_width;
+    using egret::math::solver::jacobian_matrix;
+
+    // x_i^3 + 2 x_i - x_{i-1} - x_{i+1} = b_i, whose solution is 0.5 + 0.01 i
+    struct tridiagonal_system {
+        std::size_t n;
+        std::vector<double> b;
+
+        explicit tridiagonal_system(std::size_t n)
+            : n(n), b(n)
+        {
+            const auto x = solution();
+            for (std::size_t i = 0; i != n; ++i) {
+                b[i] = lhs(x, i);
+            }
+        }
+
+        std::vector<double> solution() const
+        {
+            auto result = std::vector<double>(n);
+            for (std::size_t i = 0; i != n; ++i) {
+                result[i] = 0.5 + 0.01 * static_cast<double>(i);
+            }
+            return result;
+        }
+
+        double lhs(std::span<const double> x, std::size_t i) const
+        {
+            double result = x[i] * x[i] * x[i] + 2. * x[i];
+            if (i != 0) {
+                result -= x[i - 1];
+            }
+            if (i + 1 != n) {
+                result -= x[i + 1];
+            }
+            return result;
+        }
+
+        void residual(std::span<const double> x, std::span<double> r) const
+        {
+            for (std::size_t i = 0; i != n; ++i) {
+                r[i] = lhs(x, i) - b[i];
+            }
+        }
+
+        void jacobian(std::span<const double> x, jacobian_matrix<double>& jac) const
+        {
+            for (std::size_t i = 0; i != n; ++i) {
+                jac(i, i) = 3. * x[i] * x[i] + 2.;
+                if (i != 0) {
+                    jac(i, i - 1) = -1.;
+                }
+                if (i + 1 != n) {
+                    jac(i, i + 1) = -1.;
+                }
+            }
+        }
+    };
+
+}} // namespace egret::tests
+
+TEST(newton_nd, nonlinear_system) {
+    namespace solver = egret::math::solver;
+    // x^2 + y^2 = 4, x = y
+    const auto residual = [](std::span<const double> x, std::span<double> r) {
+        r[0] = x[0] * x[0] + x[1] * x[1] - 4.;
+        r[1] = x[0] - x[1];
+    };
+    const auto jacobian = [](std::span<const double> x, solver::jacobian_matrix<double>& jac) {
+        jac(0, 0) = 2. * x[0];
+        jac(0, 1) = 2. * x[1];
+        jac(1, 0) = 1.;
+        jac(1, 1) = -1.;
+    };
+    const auto result = solver::newton_nd(residual, jacobian, std::vector<double> {1., 0.5});
+    ASSERT_TRUE(result.result().has_value());
+    EXPECT_NEAR((*result.result())[0], std::sqrt(2.), 1e-12);
+    EXPECT_NEAR((*result.result())[1], std::sqrt(2.), 1e-12);
+    EXPECT_FALSE(result.log().empty());
+    for (const auto& item : result.log()) {
+        EXPECT_GT(item.log.damping, 0.);
+        EXPECT_LE(item.log.damping, 1.);
+    }
+}
+
+TEST(newton_nd, banded_agrees_with_dense) {
+    namespace solver = egret::math::solver;
+    const auto system = egret::tests::tridiagonal_system(50);
+    const auto residual = [&system](std::span<const double> x, std::span<double> r) { system.residual(x, r); };
+    const auto jacobian = [&system](std::span<const double> x, solver::jacobian_matrix<double>& jac) { system.jacobian(x, jac); };
+    const auto dense = solver::newton_nd(residual, jacobian, std::vector<double>(50, 0.));
+    const auto banded = solver::newton_nd(residual, jacobian, std::vector<double>(50, 0.), {}, solver::band_width {1, 1});
+    ASSERT_TRUE(dense.result().has_value());
+    ASSERT_TRUE(banded.result().has_value());
+    const auto expected = system.solution();
+    for (std::size_t i = 0; i != 50; ++i) {
+        EXPECT_NEAR((*dense.result())[i], expected[i], 1e-12);
+        EXPECT_NEAR((*banded.result())[i], expected[i], 1e-12);
+    }
+}
+
+TEST(newton_nd, line_search_failure) {
+    namespace solver = egret::math::solver;
+    // the jacobian has the wrong sign, so that no step along the newton direction decreases the residual
+    const auto residual = [](std::span<const double> x, std::span<double> r) { r[0] = x[0]; };
+    const auto jacobian = [](std::span<const double>, solver::jacobian_matrix<double>& jac) { jac(0, 0) = -1.; };
+    const auto result = solver::newton_nd(residual, jacobian, std::vector<double> {1.}, {.max_line_search = 4});
+    EXPECT_FALSE(result.result().has_value());
+    EXPECT_TRUE(result.log().empty());
+}
+
+TEST(newton_nd, logs_step_length_used) {
+    namespace solver = egret::math::solver;
+    // |atan(x)| decreases only for short steps far from the root
+    const auto residual = [](std::span<const double> x, std::span<double> r) { r[0] = std::atan(x[0]); };
+    const auto jacobian = [](std::span<const double> x, solver::jacobian_matrix<double>& jac) { jac(0, 0) = 1. / (1. + x[0] * x[0]); };
+    const auto result = solver::newton_nd(residual, jacobian, std::vector<double> {3.});
+    ASSERT_TRUE(result.result().has_value());
+    EXPECT_NEAR((*result.result())[0], 0., 1e-10);
+
+    // the first full step is (1 + 9) atan(3)
+    const auto& first = result.log().front().log;
+    EXPECT_LT(first.damping, 1.);
+    EXPECT_NEAR(first.step_norm, first.damping * 10. * std::atan(3.), 1e-12);
+}
+
+TEST(newton_nd, workspace_reuse) {
+    namespace solver = egret::math::solver;
+    const auto system = egret::tests::tridiagonal_system(20);
+    const auto residual = [&system](std::span<const double> x, std::span<double> r) { system.residual(x, r); };
+    const auto jacobian = [&system](std::span<const double> x, solver::jacobian_matrix<double>& jac) { system.jacobian(x, jac); };
+    auto ws = solver::nd_solver_workspace<double> {};
+    const auto first = solver::newton_nd(residual, jacobian, std::vector<double>(20, 0.), {}, solver::band_width {1, 1}, ws);
+    const auto* step = ws.step.data();
+    const auto* pivots = ws.pivots.data();
+    const auto second = solver::newton_nd(residual, jacobian, std::vector<double>(20, 0.), {}, solver::band_width {1, 1}, ws);
+    ASSERT_TRUE(first.result().has_value());
+    ASSERT_TRUE(second.result().has_value());
+    EXPECT_EQ(*first.result(), *second.result());
+    EXPECT_EQ(first.log().size(), second.log().size());
+    EXPECT_EQ(ws.step.data(), step);
+    EXPECT_EQ(ws.pivots.data(), pivots);
+
+    // the same workspace serves levenberg_marquardt on the dense system
+    const auto lm = solver::levenberg_marquardt(residual, jacobian, std::vector<double>(20, 0.), 20, {}, std::nullopt, ws);
+    ASSERT_TRUE(lm.result().has_value());
+    for (std::size_t i = 0; i != 20; ++i) {
+        EXPECT_NEAR((*lm.result())[i], (*first.result())[i], 1e-10);
+    }
+}
+
+TEST(levenberg_marquardt, overdetermined_fit) {
+    namespace solver = egret::math::solver;
+    // y = a exp(b t) sampled at t = 0, ..., 4 with a = 2, b = -0.3
+    constexpr std::size_t m = 5;
+    const auto residual = [](std::span<const double> x, std::span<double> r) {
+        for (std::size_t i = 0; i != m; ++i) {
+            const double t = static_cast<double>(i);
+            r[i] = x[0] * std::exp(x[1] * t) - 2. * std::exp(-0.3 * t);
+        }
+    };
+    const auto jacobian = [](std::span<const double> x, solver::jacobian_matrix<double>& jac) {
+        for (std::size_t i = 0; i != m; ++i) {
+            const double t = static_cast<double>(i);
+            jac(i, 0) = std::exp(x[1] * t);
+            jac(i, 1) = x[0] * t * std::exp(x[1] * t);
+        }
+    };
+    const auto result = solver::levenberg_marquardt(residual, jacobian, std::vector<double> {1., 0.}, m);
+    ASSERT_TRUE(result.result().has_value());
+    EXPECT_NEAR((*result.result())[0], 2., 1e-9);
+    EXPECT_NEAR((*result.result())[1], -0.3, 1e-9);
+}
@@ -0,0 +1,79 @@
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+#include "core/utils/range_utils/find_interval.h"
+
+namespace egret::tests { namespace {
+    const auto grids = std::vector<double> {0., 0.5, 1., 2., 3., 5., 7., 10., 15., 20., 30.};
+
+    // knots, points inside intervals and points outside the grids
+    std::vector<double> queries()
+    {
+        auto result = std::vector<double> {-100., -1., 30.5, 100.};
+        for (std::size_t i = 0; i != grids.size(); ++i) {
+            result.push_back(grids[i]);
+            if (i + 1 != grids.size()) {
+                result.push_back((grids[i] + grids[i + 1]) / 2.);
+            }
+        }
+        auto rng = std::mt19937_64(20240603);
+        auto dist = std::uniform_real_distribution<double>(-1., 31.);
+        for (std::size_t i = 0; i != 100; ++i) {
+            result.push_back(dist(rng));
+        }
+        return result;
+    }
+
+}} // namespace egret::tests
+
+TEST(find_interval, find_interval_near_any_hint) {
+    using namespace egret::tests;
+    const auto n = static_cast<std::ptrdiff_t>(grids.size());
+    for (const double x : queries()) {
+        const auto expected = egret::util::find_interval(grids, x);
+        // hints anywhere in the grids, and stale ones out of range
+        for (std::ptrdiff_t hint = -3; hint <= n + 3; ++hint) {
+            const auto actual = egret::util::find_interval_near(grids, x, hint);
+            EXPECT_EQ(actual.first, expected.first) << "x=" << x << ", hint=" << hint;
+            EXPECT_EQ(actual.second, expected.second) << "x=" << x << ", hint=" << hint;
+        }
+        const auto far = egret::util::find_interval_near(grids, x, std::numeric_limits<std::ptrdiff_t>::max());
+        EXPECT_EQ(far.first, expected.first) << "x=" << x;
+    }
+}
+
+TEST(find_interval, find_interval_near_chained_hints) {
+    using namespace egret::tests;
+    // hints carried over from the previous query, as interval_hint does
+    std::ptrdiff_t hint = 0;
+    for (const double x : queries()) {
+        const auto expected = egret::util::find_interval(grids, x);
+        const auto actual = egret::util::find_interval_near(grids, x, hint);
+        EXPECT_EQ(actual.first, expected.first) << "x=" << x << ", hint=" << hint;
+        hint = actual.first - grids.begin();
+    }
+}
+
+TEST(find_interval, find_interval_near_with_comparison) {
+    using namespace egret::tests;
+    const auto descending = std::vector<double>(grids.rbegin(), grids.rend());
+    const auto n = static_cast<std::ptrdiff_t>(descending.size());
+    for (const double x : queries()) {
+        const auto expected = egret::util::find_interval(descending, x, std::ranges::greater {});
+        for (std::ptrdiff_t hint = 0; hint != n; ++hint) {
+            const auto actual = egret::util::find_interval_near(descending, x, hint, std::ranges::greater {});
+            EXPECT_EQ(actual.first, expected.first) << "x=" << x << ", hint=" << hint;
+        }
+    }
+}
+
+TEST(find_interval, find_interval_near_too_few_grids) {
+    const auto one = std::vector<double> {1.};
+    EXPECT_THROW(egret::util::find_interval_near(one, 1., 0), std::exception);
+
+    const auto two = std::vector<double> {0., 1.};
+    for (const double x : {-1., 0., 0.5, 1., 2.}) {
+        EXPECT_EQ(egret::util::find_interval_near(two, x, 5).first, two.begin());
+    }
+}
@@ -0,0 +1,86 @@
+#include <random>
+#include <vector>
+#include "core/utils/range_utils/find_interval.h"
+#include "core/utils/range_utils/sorted_vector.h"
+
+namespace egret::tests { namespace {
+    // strictly increasing grids with irregular steps
+    std::vector<double> sample_grids(std::size_t n)
+    {
+        auto rng = std::mt19937_64(20240605 + n);
+        auto result = std::vector<double>(n);
+        double t = 0.;
+        for (auto& x : result) {
+            t += 1. + static_cast<double>(rng() % 3);
+            x = t;
+        }
+        return result;
+    }
+
+    // every knot, every midpoint and points outside the grids
+    std::vector<double> sample_queries(const std::vector<double>& grids)
+    {
+        auto result = std::vector<double> {grids.front() - 1., grids.back() + 1.};
+        for (std::size_t i = 0; i != grids.size(); ++i) {
+            result.push_back(grids[i]);
+            if (i + 1 != grids.size()) {
+                result.push_back((grids[i] + grids[i + 1]) / 2.);
+            }
+        }
+        return result;
+    }
+
+    template <egret::util::search_layout Layout>
+    void expect_agree_with_find_interval(std::size_t n)
+    {
+        const auto grids = sample_grids(n);
+        const auto sorted = egret::util::sorted_vector<double, Layout>(grids);
+        ASSERT_EQ(sorted.get(), grids);
+        for (const double x : sample_queries(grids)) {
+            const auto expected = egret::util::find_interval(grids, x).first - grids.begin();
+            const auto actual = egret::util::find_interval(sorted, x);
+            EXPECT_EQ(actual.first - sorted.begin(), expected) << "n=" << n << ", x=" << x;
+            EXPECT_EQ(actual.second, std::ranges::next(actual.first));
+        }
+    }
+
+}} // namespace egret::tests
+
+TEST(sorted_vector, branchless_agrees_with_find_interval) {
+    // sizes around powers of two, which bound the levels of the search
+    for (std::size_t n = 2; n != 70; ++n) {
+        egret::tests::expect_agree_with_find_interval<egret::util::search_layout::branchless>(n);
+    }
+    egret::tests::expect_agree_with_find_interval<egret::util::search_layout::branchless>(1000);
+}
+
+TEST(sorted_vector, eytzinger_agrees_with_find_interval) {
+    for (std::size_t n = 2; n != 70; ++n) {
+        egret::tests::expect_agree_with_find_interval<egret::util::search_layout::eytzinger>(n);
+    }
+    egret::tests::expect_agree_with_find_interval<egret::util::search_layout::eytzinger>(1000);
+}
+
+TEST(sorted_vector, find_interval_branchless) {
+    for (const std::size_t n : {2, 3, 4, 5, 8, 17, 64, 1000}) {
+        const auto grids = egret::tests::sample_grids(n);
+        for (const double x : egret::tests::sample_queries(grids)) {
+            EXPECT_EQ(egret::util::find_interval_branchless(grids, x).first, egret::util::find_interval(grids, x).first)
+                << "n=" << n << ", x=" << x;
+        }
+    }
+}
+
+TEST(sorted_vector, requires_strictly_increasing_elements) {
+    using grids_t = egret::util::sorted_vector<double>;
+    EXPECT_THROW(grids_t(std::vector<double> {0., 1., 1., 2.}), std::exception);
+    EXPECT_THROW(grids_t(std::vector<double> {0., 2., 1.}), std::exception);
+    EXPECT_NO_THROW(grids_t({0., 1., 2.}));
+}
+
+TEST(sorted_vector, too_few_elements) {
+    const auto one = egret::util::sorted_vector<double>({1.});
+    EXPECT_THROW(egret::util::find_interval(one, 1.), std::exception);
+    const auto branchless = egret::util::sorted_vector<double, egret::util::search_layout::branchless>({1.});
+    EXPECT_THROW(egret::util::find_interval(branchless, 1.), std::exception);
+}
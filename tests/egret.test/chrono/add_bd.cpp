@@ -0,0 +1,87 @@
+#include "core/chrono/calendars/calendar.h"
+#include "egret/chrono/adjustments/add_bd.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    egret::chrono::calendar sample_calendar()
+    {
+        return egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {
+                std::chrono::sys_days(2024y / 1 / 1),
+                std::chrono::sys_days(2024y / 5 / 3),
+                std::chrono::sys_days(2024y / 12 / 31),
+            },
+            {
+                std::chrono::sys_days(2024y / 6 / 1),
+            }
+        );
+    }
+
+// -----------------------------------------------------------------------------
+//  reference_add_bd
+// -----------------------------------------------------------------------------
+    std::chrono::sys_days reference_add_bd(const egret::chrono::calendar& cal, std::chrono::sys_days d, int count)
+    {
+        const auto step = std::chrono::days(count < 0 ? -1 : 1);
+        for (auto remained = std::abs(count); remained != 0; ) {
+            d += step;
+            if (cal.is_businessday(d)) {
+                --remained;
+            }
+        }
+        return d;
+    }
+
+}} // namespace egret::tests
+
+TEST(add_bd, from_businessday) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto d = std::chrono::sys_days(2024y / 5 / 2);
+
+    EXPECT_EQ(std::chrono::sys_days(2024y / 5 / 6), egret::chrono::add_bd(1, cal)(d));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 5 / 1), egret::chrono::add_bd(-1, cal)(d));
+    EXPECT_EQ(d, egret::chrono::add_bd(0, cal)(d));
+}
+
+TEST(add_bd, from_holiday) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+
+    // counts business days strictly after / before the start date, so that a holiday start is not rolled first
+    const auto new_year = std::chrono::sys_days(2024y / 1 / 1);
+    EXPECT_EQ(std::chrono::sys_days(2024y / 1 / 2), egret::chrono::add_bd(1, cal)(new_year));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 1 / 3), egret::chrono::add_bd(2, cal)(new_year));
+    EXPECT_EQ(std::chrono::sys_days(2023y / 12 / 29), egret::chrono::add_bd(-1, cal)(new_year));
+
+    const auto saturday = std::chrono::sys_days(2024y / 1 / 6);
+    EXPECT_EQ(std::chrono::sys_days(2024y / 1 / 8), egret::chrono::add_bd(1, cal)(saturday));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 1 / 5), egret::chrono::add_bd(-1, cal)(saturday));
+    EXPECT_EQ(saturday, egret::chrono::add_bd(0, cal)(saturday));
+}
+
+TEST(add_bd, consistent_with_reference) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+
+    const auto from = std::chrono::sys_days(2023y / 12 / 1);
+    const auto to = std::chrono::sys_days(2025y / 2 / 1);
+    for (auto d = from; d < to; d += std::chrono::days(1)) {
+        for (const auto count : {-10, -3, -1, 0, 1, 3, 10}) {
+            ASSERT_EQ(egret::tests::reference_add_bd(cal, d, count), egret::chrono::add_bd(count, cal)(d))
+                << "date=" << egret::util::to_string(d) << ", count=" << count;
+        }
+    }
+}
+
+TEST(add_bd, sys_seconds) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto s = std::chrono::sys_seconds(std::chrono::sys_days(2024y / 5 / 2)) + std::chrono::hours(9);
+    EXPECT_EQ(std::chrono::sys_seconds(std::chrono::sys_days(2024y / 5 / 6)) + std::chrono::hours(9), egret::chrono::add_bd(1, cal)(s));
+}
@@ -0,0 +1,110 @@
+#include <memory>
+#include "egret/chrono/daycounters/act360.h"
+#include "egret/chrono/daycounters/act365f.h"
+#include "egret/chrono/daycounters/any_daycounter.h"
+#include "egret/chrono/daycounters/daycounter.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample counters
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+    using egret::chrono::any_daycounter;
+
+    // stateful counter not fitting the buffer. token counts the shared models alive.
+    struct scaled_t {
+        double denominator;
+        std::shared_ptr<int> token;
+
+        double operator()(const std::chrono::sys_days& from, const std::chrono::sys_days& to) const
+        {
+            return (to - from).count() / denominator;
+        }
+    };
+
+    const auto from = std::chrono::sys_days(2024y / 1 / 1);
+    const auto to = std::chrono::sys_days(2024y / 7 / 1);
+
+}} // namespace egret::tests
+
+TEST(any_daycounter, is_inplace) {
+    using egret::chrono::any_daycounter;
+    static_assert(any_daycounter<>::is_inplace<egret::chrono::act360_t>);
+    static_assert(any_daycounter<>::is_inplace<egret::chrono::act365f_t>);
+    static_assert(any_daycounter<>::is_inplace<egret::chrono::daycounter>);
+    static_assert(!any_daycounter<>::is_inplace<egret::tests::scaled_t>);
+
+    EXPECT_TRUE(any_daycounter<>(egret::chrono::act360).is_buffered());
+    EXPECT_TRUE(any_daycounter<>(egret::chrono::daycounter(egret::chrono::act365f)).is_buffered());
+    EXPECT_FALSE(any_daycounter<>(egret::tests::scaled_t {180., nullptr}).is_buffered());
+}
+
+TEST(any_daycounter, copy_and_move_construction) {
+    using egret::chrono::any_daycounter;
+    const auto token = std::make_shared<int>(0);
+    {
+        const auto inplace = any_daycounter<>(egret::chrono::act360);
+        const auto shared = any_daycounter<>(egret::tests::scaled_t {180., token});
+        EXPECT_EQ(2, token.use_count());
+
+        const auto inplace_copy = inplace;
+        const auto shared_copy = shared;
+        EXPECT_TRUE(inplace_copy.is_buffered());
+        EXPECT_FALSE(shared_copy.is_buffered());
+        EXPECT_EQ(2, token.use_count());
+        EXPECT_DOUBLE_EQ(182. / 360., inplace_copy(egret::tests::from, egret::tests::to));
+        EXPECT_DOUBLE_EQ(182. / 180., shared_copy(egret::tests::from, egret::tests::to));
+
+        auto inplace_src = inplace;
+        auto shared_src = shared;
+        const auto inplace_moved = std::move(inplace_src);
+        const auto shared_moved = std::move(shared_src);
+        EXPECT_FALSE(inplace_src.is_buffered());
+        EXPECT_TRUE(inplace_moved.is_buffered());
+        EXPECT_FALSE(shared_moved.is_buffered());
+        EXPECT_EQ(2, token.use_count());
+        EXPECT_DOUBLE_EQ(182. / 360., inplace_moved(egret::tests::from, egret::tests::to));
+        EXPECT_DOUBLE_EQ(182. / 180., shared_moved(egret::tests::from, egret::tests::to));
+        EXPECT_TRUE(shared_moved.as<egret::tests::scaled_t>().has_value());
+    }
+    EXPECT_EQ(1, token.use_count());
+}
+
+TEST(any_daycounter, assignment_across_storages) {
+    using egret::chrono::any_daycounter;
+    const auto token = std::make_shared<int>(0);
+    {
+        const auto inplace = any_daycounter<>(egret::chrono::act365f);
+        const auto shared = any_daycounter<>(egret::tests::scaled_t {180., token});
+
+        // inline <- shared <- inline
+        auto dc = any_daycounter<>(egret::chrono::act360);
+        dc = shared;
+        EXPECT_FALSE(dc.is_buffered());
+        EXPECT_EQ(typeid(egret::tests::scaled_t), dc.type());
+        EXPECT_DOUBLE_EQ(182. / 180., dc(egret::tests::from, egret::tests::to));
+        dc = inplace;
+        EXPECT_TRUE(dc.is_buffered());
+        EXPECT_EQ(typeid(egret::chrono::act365f_t), dc.type());
+        EXPECT_DOUBLE_EQ(182. / 365., dc(egret::tests::from, egret::tests::to));
+        EXPECT_EQ(2, token.use_count());
+
+        // move assignments release the former storage
+        auto shared_src = shared;
+        dc = std::move(shared_src);
+        EXPECT_FALSE(dc.is_buffered());
+        EXPECT_DOUBLE_EQ(182. / 180., dc(egret::tests::from, egret::tests::to));
+        auto inplace_src = inplace;
+        dc = std::move(inplace_src);
+        EXPECT_TRUE(dc.is_buffered());
+        EXPECT_DOUBLE_EQ(182. / 365., dc(egret::tests::from, egret::tests::to));
+        EXPECT_EQ(2, token.use_count());
+
+        // self assignment and reassigning a moved-from counter
+        dc = std::as_const(dc);
+        EXPECT_DOUBLE_EQ(182. / 365., dc(egret::tests::from, egret::tests::to));
+        inplace_src = shared;
+        EXPECT_DOUBLE_EQ(182. / 180., inplace_src(egret::tests::from, egret::tests::to));
+    }
+    EXPECT_EQ(1, token.use_count());
+}
@@ -0,0 +1,123 @@
+#include <vector>
+#include "egret/chrono/daycounters/act360.h"
+#include "egret/chrono/daycounters/act365f.h"
+#include "egret/chrono/daycounters/any_daycounter.h"
+#include "egret/chrono/daycounters/daycounter.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    template <typename TimePoint>
+    std::pair<std::vector<TimePoint>, std::vector<TimePoint>> sample_periods()
+    {
+        auto from = std::vector<TimePoint>();
+        auto to = std::vector<TimePoint>();
+        for (int i = 0; i != 20; ++i) {
+            const auto start = std::chrono::sys_days(2024y / 1 / 1) + std::chrono::days(17 * i);
+            // hours are dropped for sys_days
+            from.push_back(std::chrono::floor<typename TimePoint::duration>(start + std::chrono::hours(i % 5)));
+            to.push_back(std::chrono::floor<typename TimePoint::duration>(start + std::chrono::days(31 * i % 400 - 30) + std::chrono::hours(i % 3)));
+        }
+        return {std::move(from), std::move(to)};
+    }
+
+    // bulk dcf through the cpo agrees with the scalar one element by element
+    template <typename TimePoint = std::chrono::sys_days, typename DC>
+    void expect_bulk_agrees(const DC& dc)
+    {
+        const auto [from, to] = sample_periods<TimePoint>();
+        auto result = std::vector<double>(from.size());
+        egret::chrono::dcf(dc, std::span<const TimePoint>(from), std::span<const TimePoint>(to), std::span<double>(result));
+        for (std::size_t i = 0; i != from.size(); ++i) {
+            EXPECT_EQ(egret::chrono::dcf(dc, from[i], to[i]), result[i]) << "i=" << i;
+        }
+    }
+
+    // counter without a bulk kernel, found by adl
+    struct thirty_days_t {};
+
+    double dcf(const thirty_days_t&, const std::chrono::sys_days& from, const std::chrono::sys_days& to)
+    {
+        return (to - from).count() / 30.;
+    }
+
+    // counter whose bulk kernel counts its calls
+    struct counting_t {
+        inline static int bulk_calls = 0;
+
+        double operator()(const std::chrono::sys_days& from, const std::chrono::sys_days& to) const
+        {
+            return (to - from).count() / 100.;
+        }
+        void operator()(std::span<const std::chrono::sys_days> from, std::span<const std::chrono::sys_days> to, std::span<double> result) const
+        {
+            ++bulk_calls;
+            for (std::size_t i = 0; i != from.size(); ++i) {
+                result[i] = (*this)(from[i], to[i]);
+            }
+        }
+    };
+
+}} // namespace egret::tests
+
+TEST(dcf, bulk_act360_act365f) {
+    egret::tests::expect_bulk_agrees(egret::chrono::act360);
+    egret::tests::expect_bulk_agrees(egret::chrono::act365f);
+    egret::tests::expect_bulk_agrees<std::chrono::sys_seconds>(egret::chrono::act360);
+    egret::tests::expect_bulk_agrees<std::chrono::sys_seconds>(egret::chrono::act365f);
+}
+
+TEST(dcf, bulk_daycounter_variant) {
+    using egret::chrono::daycounter;
+    for (const auto& dc : {daycounter(egret::chrono::act360), daycounter(egret::chrono::act365f)}) {
+        egret::tests::expect_bulk_agrees(dc);
+        egret::tests::expect_bulk_agrees<std::chrono::sys_seconds>(dc);
+    }
+    using single_variant = egret::chrono::daycounter_variant<std::chrono::sys_days, egret::chrono::act360_t, egret::tests::thirty_days_t>;
+    egret::tests::expect_bulk_agrees(single_variant(egret::chrono::act360));
+    egret::tests::expect_bulk_agrees(single_variant(egret::tests::thirty_days_t {}));
+}
+
+TEST(dcf, bulk_any_daycounter) {
+    using egret::chrono::any_daycounter;
+    egret::tests::expect_bulk_agrees(any_daycounter<>(egret::chrono::act360));
+    egret::tests::expect_bulk_agrees(any_daycounter<>(egret::chrono::act365f));
+    egret::tests::expect_bulk_agrees(any_daycounter<>(egret::chrono::daycounter(egret::chrono::act365f)));
+    egret::tests::expect_bulk_agrees(any_daycounter<>(egret::tests::thirty_days_t {}));
+    egret::tests::expect_bulk_agrees<std::chrono::sys_seconds>(any_daycounter<std::chrono::sys_seconds>(egret::chrono::act360));
+
+    // one bulk call is forwarded as is
+    egret::tests::counting_t::bulk_calls = 0;
+    egret::tests::expect_bulk_agrees(any_daycounter<>(egret::tests::counting_t {}));
+    EXPECT_EQ(1, egret::tests::counting_t::bulk_calls);
+}
+
+TEST(dcf, bulk_fallback) {
+    egret::tests::expect_bulk_agrees(egret::tests::thirty_days_t {});
+    egret::tests::counting_t::bulk_calls = 0;
+    egret::tests::expect_bulk_agrees(egret::tests::counting_t {});
+    EXPECT_EQ(1, egret::tests::counting_t::bulk_calls);
+}
+
+TEST(dcf, bulk_size_mismatch) {
+    using namespace std::chrono_literals;
+    const auto from = std::vector<std::chrono::sys_days> {2024y / 1 / 1, 2024y / 2 / 1};
+    const auto to = std::vector<std::chrono::sys_days> {2024y / 7 / 1, 2024y / 8 / 1};
+    const auto short_to = std::vector<std::chrono::sys_days> {2024y / 7 / 1};
+    auto result = std::vector<double>(3, -1.);
+    const auto bulk = [&](const auto& dc, const auto& to, std::size_t n) {
+        egret::chrono::dcf(dc, std::span<const std::chrono::sys_days>(from), std::span<const std::chrono::sys_days>(to), std::span<double>(result).first(n));
+    };
+    for (const auto& dc : {egret::chrono::any_daycounter<>(egret::chrono::act360), egret::chrono::any_daycounter<>(egret::tests::thirty_days_t {})}) {
+        EXPECT_THROW(bulk(dc, short_to, 2), egret::exception);
+        EXPECT_THROW(bulk(dc, to, 1), egret::exception);
+
+        // a longer result is written only up to the size of from
+        bulk(dc, to, 3);
+        EXPECT_EQ(egret::chrono::dcf(dc, from[1], to[1]), result[1]);
+        EXPECT_EQ(-1., result[2]);
+    }
+}
@@ -0,0 +1,82 @@
+#include <vector>
+#include "core/chrono/calendars/calendar.h"
+#include "egret/chrono/adjustments/holiday_adjustment.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    egret::chrono::calendar sample_calendar()
+    {
+        return egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {
+                std::chrono::sys_days(2024y / 4 / 29),
+                std::chrono::sys_days(2024y / 4 / 30),
+                std::chrono::sys_days(2024y / 5 / 3),
+            },
+            {}
+        );
+    }
+
+    std::vector<std::chrono::sys_days> sample_dates()
+    {
+        auto result = std::vector<std::chrono::sys_days> {};
+        for (auto d = std::chrono::sys_days(2024y / 4 / 20); d != std::chrono::sys_days(2024y / 5 / 10); d += std::chrono::days(1)) {
+            result.push_back(d);
+        }
+        return result;
+    }
+
+    constexpr egret::chrono::holiday_adjustment_type adjustment_types[] = {
+        egret::chrono::holiday_adjustment_type::unadjust,
+        egret::chrono::holiday_adjustment_type::following,
+        egret::chrono::holiday_adjustment_type::preceeding,
+        egret::chrono::holiday_adjustment_type::modified_following,
+        egret::chrono::holiday_adjustment_type::modified_preceeding,
+    };
+
+}} // namespace egret::tests
+
+TEST(holiday_adjustment, batch_agrees_with_scalar) {
+    using namespace egret::tests;
+    const auto cal = sample_calendar();
+    const auto ds = sample_dates();
+    for (const auto type : adjustment_types) {
+        auto result = std::vector<std::chrono::sys_days>(ds.size());
+        egret::chrono::adjust(ds, result, cal, type);
+        for (std::size_t i = 0; i != ds.size(); ++i) {
+            EXPECT_EQ(result[i], egret::chrono::adjust(ds[i], cal, type)) << "i=" << i;
+        }
+    }
+}
+
+TEST(holiday_adjustment, batch_in_place_and_overlapping) {
+    using namespace egret::tests;
+    const auto cal = sample_calendar();
+    const auto ds = sample_dates();
+    const auto n = ds.size();
+    for (const auto type : adjustment_types) {
+        auto expected = std::vector<std::chrono::sys_days>(n);
+        egret::chrono::adjust(ds, expected, cal, type);
+
+        // result is the same span as ds
+        auto same = ds;
+        egret::chrono::adjust(std::span<const std::chrono::sys_days>(same), std::span(same), cal, type);
+        EXPECT_EQ(same, expected);
+
+        // result starts after ds and overlaps its tail
+        auto after = std::vector<std::chrono::sys_days>(n + 3);
+        std::ranges::copy(ds, after.begin());
+        egret::chrono::adjust(std::span<const std::chrono::sys_days>(after.data(), n), std::span(after.data() + 3, n), cal, type);
+        EXPECT_TRUE(std::ranges::equal(std::span(after.data() + 3, n), expected));
+
+        // result starts before ds and overlaps its head
+        auto before = std::vector<std::chrono::sys_days>(n + 3);
+        std::ranges::copy(ds, before.begin() + 3);
+        egret::chrono::adjust(std::span<const std::chrono::sys_days>(before.data() + 3, n), std::span(before.data(), n), cal, type);
+        EXPECT_TRUE(std::ranges::equal(std::span(before.data(), n), expected));
+    }
+}
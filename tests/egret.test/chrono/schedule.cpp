@@ -0,0 +1,177 @@
+#include "core/chrono/calendars/calendar.h"
+#include "egret/chrono/schedules/schedule.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    egret::chrono::calendar sample_calendar()
+    {
+        return egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {
+                std::chrono::sys_days(2024y / 1 / 1),
+                std::chrono::sys_days(2024y / 5 / 3),
+                std::chrono::sys_days(2024y / 12 / 31),
+            },
+            {
+                std::chrono::sys_days(2024y / 6 / 1),
+            }
+        );
+    }
+
+    egret::chrono::schedule_convention unadjusted_convention(egret::chrono::tenor tnr, egret::chrono::schedule_generation generation)
+    {
+        return {
+            .tenor = tnr,
+            .accrual_adjustment = egret::chrono::holiday_adjustment_type::unadjust,
+            .payment_adjustment = egret::chrono::holiday_adjustment_type::unadjust,
+            .generation = generation,
+        };
+    }
+
+// -----------------------------------------------------------------------------
+//  accrual_dates
+// -----------------------------------------------------------------------------
+    std::vector<std::chrono::sys_days> accrual_dates(const std::vector<egret::chrono::schedule_period>& periods)
+    {
+        auto result = std::vector<std::chrono::sys_days>();
+        for (const auto& p : periods) {
+            if (result.empty()) {
+                result.push_back(p.accrual_start);
+            }
+            EXPECT_EQ(result.back(), p.accrual_start);
+            result.push_back(p.accrual_end);
+        }
+        return result;
+    }
+
+}} // namespace egret::tests
+
+TEST(schedule, backward_short_front_stub) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto convention = egret::tests::unadjusted_convention(egret::chrono::tenor::months(3), egret::chrono::schedule_generation::backward);
+    const auto periods = egret::chrono::make_schedule(2024y / 2 / 10, 2024y / 12 / 15, convention, cal);
+
+    const auto expected = std::vector<std::chrono::sys_days> {2024y / 2 / 10, 2024y / 3 / 15, 2024y / 6 / 15, 2024y / 9 / 15, 2024y / 12 / 15};
+    EXPECT_EQ(expected, egret::tests::accrual_dates(periods));
+}
+
+TEST(schedule, forward_short_back_stub) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto convention = egret::tests::unadjusted_convention(egret::chrono::tenor::months(3), egret::chrono::schedule_generation::forward);
+    const auto periods = egret::chrono::make_schedule(2024y / 2 / 10, 2024y / 12 / 15, convention, cal);
+
+    const auto expected = std::vector<std::chrono::sys_days> {2024y / 2 / 10, 2024y / 5 / 10, 2024y / 8 / 10, 2024y / 11 / 10, 2024y / 12 / 15};
+    EXPECT_EQ(expected, egret::tests::accrual_dates(periods));
+}
+
+TEST(schedule, end_of_month) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    auto forward = egret::tests::unadjusted_convention(egret::chrono::tenor::months(1), egret::chrono::schedule_generation::forward);
+    auto backward = egret::tests::unadjusted_convention(egret::chrono::tenor::months(1), egret::chrono::schedule_generation::backward);
+
+    // day of the anchor is kept and clamped to short months
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 2 / 29, 2024y / 3 / 29, 2024y / 4 / 29, 2024y / 5 / 29, 2024y / 6 / 29}),
+        egret::tests::accrual_dates(egret::chrono::make_schedule(2024y / 2 / 29, 2024y / 6 / 29, forward, cal))
+    );
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 1 / 31, 2024y / 2 / 29, 2024y / 3 / 30, 2024y / 4 / 30}),
+        egret::tests::accrual_dates(egret::chrono::make_schedule(2024y / 1 / 31, 2024y / 4 / 30, backward, cal))
+    );
+
+    // month end anchors roll to month ends
+    forward.end_of_month = true;
+    backward.end_of_month = true;
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 2 / 29, 2024y / 3 / 31, 2024y / 4 / 30, 2024y / 5 / 31, 2024y / 6 / 30}),
+        egret::tests::accrual_dates(egret::chrono::make_schedule(2024y / 2 / 29, 2024y / 6 / 30, forward, cal))
+    );
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 1 / 31, 2024y / 2 / 29, 2024y / 3 / 31, 2024y / 4 / 30}),
+        egret::tests::accrual_dates(egret::chrono::make_schedule(2024y / 1 / 31, 2024y / 4 / 30, backward, cal))
+    );
+}
+
+TEST(schedule, roll_day) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    auto convention = egret::tests::unadjusted_convention(egret::chrono::tenor::months(2), egret::chrono::schedule_generation::forward);
+    convention.roll_day = std::chrono::day(20);
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 1 / 10, 2024y / 3 / 20, 2024y / 5 / 20, 2024y / 7 / 20}),
+        egret::tests::accrual_dates(egret::chrono::make_schedule(2024y / 1 / 10, 2024y / 7 / 20, convention, cal))
+    );
+
+    // roll day beyond the month length is clamped
+    convention.tenor = egret::chrono::tenor::months(1);
+    convention.roll_day = std::chrono::day(31);
+    EXPECT_EQ(
+        (std::vector<std::chrono::sys_days> {2024y / 1 / 15, 2024y / 2 / 29, 2024y / 3 / 31, 2024y / 4 / 30, 2024y / 5 / 15}),
+        egret::tests::accrual_dates(egret::chrono::make_schedule(2024y / 1 / 15, 2024y / 5 / 15, convention, cal))
+    );
+}
+
+TEST(schedule, adjustments_and_lags) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto convention = egret::chrono::schedule_convention {
+        .tenor = egret::chrono::tenor::months(1),
+        .accrual_adjustment = egret::chrono::holiday_adjustment_type::modified_following,
+        .payment_adjustment = egret::chrono::holiday_adjustment_type::following,
+        .payment_lag = 2,
+        .fixing_lag = 2,
+        .generation = egret::chrono::schedule_generation::backward,
+    };
+    const auto periods = egret::chrono::make_schedule(2024y / 4 / 3, 2024y / 6 / 3, convention, cal);
+
+    // 2024-05-03 is a holiday followed by a weekend
+    const auto expected = std::vector<egret::chrono::schedule_period> {
+        {
+            .accrual_start = 2024y / 4 / 3, 
+            .accrual_end = 2024y / 5 / 6, 
+            .payment_date = 2024y / 5 / 8, 
+            .fixing_date = 2024y / 4 / 1,
+        },
+        {
+            .accrual_start = 2024y / 5 / 6, 
+            .accrual_end = 2024y / 6 / 3, 
+            .payment_date = 2024y / 6 / 5, 
+            .fixing_date = 2024y / 5 / 1,
+        },
+    };
+    EXPECT_EQ(expected, periods);
+}
+
+TEST(schedule_generator, memo) {
+    using namespace std::chrono_literals;
+    const auto cal = egret::tests::sample_calendar();
+    const auto convention = egret::tests::unadjusted_convention(egret::chrono::tenor::months(3), egret::chrono::schedule_generation::backward);
+    const auto generator = egret::chrono::schedule_generator(2);
+
+    const auto s1 = generator(2024y / 1 / 15, 2025y / 1 / 15, convention, cal);
+    EXPECT_EQ(s1, generator(2024y / 1 / 15, 2025y / 1 / 15, convention, egret::tests::sample_calendar()));
+    EXPECT_EQ(egret::chrono::make_schedule(2024y / 1 / 15, 2025y / 1 / 15, convention, cal), *s1);
+    EXPECT_EQ(1, generator.size());
+
+    // the size is bounded by the capacity
+    generator(2024y / 1 / 15, 2026y / 1 / 15, convention, cal);
+    generator(2024y / 1 / 15, 2027y / 1 / 15, convention, cal);
+    EXPECT_EQ(2, generator.capacity());
+    EXPECT_EQ(2, generator.size());
+
+    // a calendar with the same identifier but different holidays rebuilds the entry
+    const auto modified = egret::chrono::calendar(cal.identifier(), {std::chrono::sys_days(2024y / 4 / 15)}, {});
+    const auto s2 = generator(2024y / 1 / 15, 2025y / 1 / 15, convention, modified);
+    EXPECT_NE(s1, s2);
+    EXPECT_EQ(egret::chrono::make_schedule(2024y / 1 / 15, 2025y / 1 / 15, convention, modified), *s2);
+
+    generator.clear();
+    EXPECT_EQ(0, generator.size());
+}
@@ -0,0 +1,107 @@
+#include <vector>
+#include "core/chrono/calendars/calendar.h"
+#include "egret/chrono/schedules/tenor_grid.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+    using egret::chrono::tenor;
+
+    egret::chrono::calendar sample_calendar()
+    {
+        return egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {
+                std::chrono::sys_days(2024y / 4 / 29),
+                std::chrono::sys_days(2024y / 4 / 30),
+                std::chrono::sys_days(2024y / 5 / 3),
+                std::chrono::sys_days(2024y / 12 / 31),
+            },
+            {}
+        );
+    }
+
+    // month ends, a leap day and dates whose tenors land on the holidays above
+    const std::vector<std::chrono::sys_days> refs = {
+        2024y / 1 / 31, 2024y / 2 / 29, 2024y / 3 / 29, 2024y / 3 / 30, 2024y / 4 / 3, 2023y / 12 / 31, 2024y / 11 / 30,
+    };
+    const std::vector<tenor> tenors = {
+        tenor::days(0), tenor::days(1), tenor::weeks(1), tenor::months(1), tenor::months(3), tenor::years(1), tenor::months(-1),
+    };
+
+    constexpr egret::chrono::holiday_adjustment_type adjustment_types[] = {
+        egret::chrono::holiday_adjustment_type::unadjust,
+        egret::chrono::holiday_adjustment_type::following,
+        egret::chrono::holiday_adjustment_type::preceeding,
+        egret::chrono::holiday_adjustment_type::modified_following,
+        egret::chrono::holiday_adjustment_type::modified_preceeding,
+    };
+
+}} // namespace egret::tests
+
+TEST(tenor_grid, unadjusted) {
+    using namespace std::chrono_literals;
+    using namespace egret::tests;
+    const auto grid = egret::chrono::tenor_grid(refs, tenors);
+    EXPECT_EQ(refs.size(), grid.rows());
+    EXPECT_EQ(tenors.size(), grid.cols());
+    EXPECT_EQ(refs.size() * tenors.size(), grid.dates().size());
+    for (std::size_t i = 0; i != refs.size(); ++i) {
+        EXPECT_TRUE(std::ranges::equal(grid.row(i), grid.dates() | std::views::drop(i * tenors.size()) | std::views::take(tenors.size())));
+        for (std::size_t j = 0; j != tenors.size(); ++j) {
+            EXPECT_EQ(refs[i] + tenors[j], grid(i, j)) << "i=" << i << ", j=" << j;
+        }
+    }
+
+    // days beyond month ends overflow into the next month as std::chrono
+    EXPECT_EQ(std::chrono::sys_days(2024y / 3 / 2), grid(0, 3));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 5 / 1), grid(0, 4));
+    EXPECT_EQ(std::chrono::sys_days(2025y / 3 / 1), grid(1, 5));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 1 / 29), grid(1, 6));
+}
+
+TEST(tenor_grid, adjusted) {
+    using namespace std::chrono_literals;
+    using namespace egret::tests;
+    const auto cal = sample_calendar();
+    for (const auto type : adjustment_types) {
+        const auto grid = egret::chrono::tenor_grid(refs, tenors, cal, type);
+        EXPECT_EQ(refs.size(), grid.rows());
+        EXPECT_EQ(tenors.size(), grid.cols());
+        for (std::size_t i = 0; i != refs.size(); ++i) {
+            for (std::size_t j = 0; j != tenors.size(); ++j) {
+                EXPECT_EQ(egret::chrono::adjust(refs[i] + tenors[j], cal, type), grid(i, j)) << "i=" << i << ", j=" << j;
+            }
+        }
+    }
+
+    // 2024-03-30 + 1M is the holiday 2024-04-30 followed by 2024-05-01, and preceded by the holiday 2024-04-29
+    using egret::chrono::holiday_adjustment_type;
+    const auto following = egret::chrono::tenor_grid(refs, tenors, cal, holiday_adjustment_type::following);
+    const auto modified_following = egret::chrono::tenor_grid(refs, tenors, cal, holiday_adjustment_type::modified_following);
+    const auto preceeding = egret::chrono::tenor_grid(refs, tenors, cal, holiday_adjustment_type::preceeding);
+    EXPECT_EQ(std::chrono::sys_days(2024y / 5 / 1), following(3, 3));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 4 / 26), modified_following(3, 3));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 4 / 26), preceeding(3, 3));
+
+    // 2024-03-30 itself is a saturday, and 2023-12-31 + 1Y is the holiday 2024-12-31 at the year end
+    EXPECT_EQ(std::chrono::sys_days(2024y / 4 / 1), following(3, 0));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 3 / 29), modified_following(3, 0));
+    EXPECT_EQ(std::chrono::sys_days(2025y / 1 / 1), following(5, 5));
+    EXPECT_EQ(std::chrono::sys_days(2024y / 12 / 30), modified_following(5, 5));
+}
+
+TEST(tenor_grid, empty) {
+    using namespace egret::tests;
+    const auto no_refs = egret::chrono::tenor_grid({}, tenors);
+    EXPECT_EQ(0, no_refs.rows());
+    EXPECT_EQ(tenors.size(), no_refs.cols());
+    EXPECT_TRUE(no_refs.dates().empty());
+
+    const auto no_tenors = egret::chrono::tenor_grid(refs, {}, sample_calendar(), egret::chrono::holiday_adjustment_type::following);
+    EXPECT_EQ(refs.size(), no_tenors.rows());
+    EXPECT_EQ(0, no_tenors.cols());
+    EXPECT_TRUE(no_tenors.dates().empty());
+}
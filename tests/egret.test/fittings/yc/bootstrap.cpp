@@ -0,0 +1,361 @@
+#include <cmath>
+#include <map>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/chrono/calendars/calendar.h"
+#include "core/math/interp1d/cspline.h"
+#include "core/math/interp1d/slopes/central_difference.h"
+#include "egret/chrono/daycounters/act365f.h"
+#include "egret/fittings/yc/bootstrap.h"
+#include "egret/fittings/yc/log_df_parametrization.h"
+#include "egret/fittings/yc/constraints/any_evaluator.h"
+#include "egret/fittings/yc/constraints/irs_constraint.h"
+#include "egret/fittings/yc/constraints/ois_constraint.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    // forward rate from the valuation date to maturity
+    struct forward_rate_constraint {
+        std::string curve;
+        std::chrono::sys_days maturity;
+        double rate;
+
+        template <typename Curve>
+        auto evaluate(const std::chrono::sys_days& vdt, const std::map<std::string, Curve>& curves) const
+        {
+            return curves.at(curve).forward_rate(vdt, maturity) - rate;
+        }
+    };
+
+    const auto vdt = std::chrono::sys_days(2024y / 1 / 15);
+    const auto pillars = std::vector<std::chrono::sys_days> {2025y / 1 / 15, 2026y / 1 / 15, 2029y / 1 / 15};
+
+    egret::fit::yc::log_df_parametrization<std::string> sample_parametrization()
+    {
+        return {vdt, {{"OIS", pillars}}};
+    }
+
+    std::vector<forward_rate_constraint> sample_constraints()
+    {
+        return {
+            {.curve = "OIS", .maturity = pillars[0], .rate = 0.010},
+            {.curve = "OIS", .maturity = pillars[1], .rate = 0.015},
+            {.curve = "OIS", .maturity = pillars[2], .rate = 0.025},
+        };
+    }
+
+// -----------------------------------------------------------------------------
+//  swaps
+// -----------------------------------------------------------------------------
+    using dc_t = egret::chrono::act365f_t;
+    using ois_t = egret::fit::yc::ois_constraint<std::string, std::string, dc_t>;
+    using irs_t = egret::fit::yc::irs_constraint<std::string, std::string, dc_t>;
+
+    // annual periods from vdt, which fall on business days for 1, 2 and 3 years
+    std::vector<std::pair<std::chrono::sys_days, std::chrono::sys_days>> annual_periods(int years)
+    {
+        const auto ymd = std::chrono::year_month_day(vdt);
+        auto result = std::vector<std::pair<std::chrono::sys_days, std::chrono::sys_days>> {};
+        for (int i = 0; i != years; ++i) {
+            result.emplace_back(ymd + std::chrono::years(i), ymd + std::chrono::years(i + 1));
+        }
+        return result;
+    }
+
+    egret::inst::cfs::fixed_leg<std::string, dc_t> fixed_leg(const std::string& discount, int years, double rate)
+    {
+        auto cfs = std::vector<egret::inst::cfs::fixed_rate_cf<>> {};
+        for (const auto& [start, end] : annual_periods(years)) {
+            cfs.push_back({
+                .notional_ratio = 1.,
+                .accrual_start = start,
+                .accrual_end = end,
+                .payment_date = end,
+                .cashout_date = end,
+                .entitlement_date = end,
+                .rate = rate,
+            });
+        }
+        return {{.discount_curve = discount, .accrual_daycounter = egret::chrono::act365f, .notional = 1.}, std::move(cfs)};
+    }
+
+    ois_t ois(const std::string& discount, const std::string& projection, int years, double rate)
+    {
+        auto cfs = std::vector<egret::inst::cfs::overnight_index_cashflow<>> {};
+        for (const auto& [start, end] : annual_periods(years)) {
+            cfs.push_back({
+                .notional_ratio = 1.,
+                .lookback = std::chrono::days(0),
+                .backward_shift = std::chrono::days(0),
+                .lockout = std::chrono::days(0),
+                .accrual_start = start,
+                .accrual_end = end,
+                .fixing_date = end,
+                .payment_date = end,
+                .cashout_date = end,
+                .entitlement_date = end,
+                .gearing = 1.,
+                .spread = 0.,
+                .fixed_coupon_rate = std::nullopt,
+            });
+        }
+        auto floating = egret::inst::cfs::overnight_index_leg<std::string, std::string, dc_t> {
+            {
+                .discount_curve = discount,
+                .projection_curve = projection,
+                .rate_daycounter = egret::chrono::act365f,
+                .accrual_daycounter = egret::chrono::act365f,
+                .rate_reference_calendar = egret::chrono::calendar(
+                    egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}), {}, {}
+                ),
+                .notional = 1.,
+            },
+            std::move(cfs)
+        };
+        return {std::move(floating), fixed_leg(discount, years, rate)};
+    }
+
+    irs_t irs(const std::string& discount, const std::string& projection, int years, double rate)
+    {
+        auto cfs = std::vector<egret::inst::cfs::term_rate_cashflow<>> {};
+        for (const auto& [start, end] : annual_periods(years)) {
+            cfs.push_back({
+                .notional_ratio = 1.,
+                .accrual_start = start,
+                .accrual_end = end,
+                .reference_start = start,
+                .reference_end = end,
+                .fixing_date = start,
+                .payment_date = end,
+                .cashout_date = end,
+                .entitlement_date = end,
+                .gearing = 1.,
+                .spread = 0.,
+                .fixed_coupon_rate = std::nullopt,
+            });
+        }
+        auto floating = egret::inst::cfs::term_rate_leg<std::string, std::string, dc_t> {
+            {
+                .discount_curve = discount,
+                .projection_curve = projection,
+                .rate_daycounter = egret::chrono::act365f,
+                .accrual_daycounter = egret::chrono::act365f,
+                .notional = 1.,
+            },
+            std::move(cfs)
+        };
+        return {std::move(floating), fixed_leg(discount, years, rate)};
+    }
+
+    const auto swap_pillars = std::vector<std::chrono::sys_days> {2025y / 1 / 15, 2026y / 1 / 15, 2027y / 1 / 15};
+
+    std::vector<ois_t> sample_ois_constraints()
+    {
+        return {ois("OIS", "OIS", 1, 0.010), ois("OIS", "OIS", 2, 0.015), ois("OIS", "OIS", 3, 0.020)};
+    }
+
+    // discount curve by ois and projection curve by irs discounted on it
+    template <typename Curve>
+    std::vector<egret::fit::yc::any_evaluator<double, std::string, Curve>> coupled_constraints(
+        const std::string& discount, const std::string& projection
+    )
+    {
+        // constraints are ordered as the parameters, which follow the order of tags
+        auto result = std::vector<egret::fit::yc::any_evaluator<double, std::string, Curve>> {};
+        for (const bool discount_part : {discount < projection, projection < discount}) {
+            for (int years = 1; years != 4; ++years) {
+                if (discount_part) {
+                    result.push_back(ois(discount, discount, years, 0.005 + 0.005 * years));
+                }
+                else {
+                    result.push_back(irs(discount, projection, years, 0.008 + 0.005 * years));
+                }
+            }
+        }
+        return result;
+    }
+
+// -----------------------------------------------------------------------------
+//  non-local interpolation
+// -----------------------------------------------------------------------------
+    // slopes at knots depend on the neighbouring knots, so that solving a pillar moves the earlier segment
+    struct make_cspline_interpolant {
+        template <typename V>
+        auto operator()(std::vector<std::chrono::sys_days> grids, std::vector<V> values) const
+        {
+            return egret::math::interp1d::cspline(std::move(grids), std::move(values), egret::math::interp1d::central_difference {});
+        }
+    };
+
+    egret::fit::yc::log_df_parametrization<std::string, make_cspline_interpolant> cspline_parametrization()
+    {
+        return {vdt, {{"OIS", pillars}}};
+    }
+
+    // maturities between pillars, so that the cspline segments of them depend on the next pillar
+    std::vector<forward_rate_constraint> off_pillar_constraints()
+    {
+        return {
+            {.curve = "OIS", .maturity = 2024y / 10 / 15, .rate = 0.010},
+            {.curve = "OIS", .maturity = 2025y / 10 / 15, .rate = 0.020},
+            {.curve = "OIS", .maturity = 2028y / 10 / 15, .rate = 0.015},
+        };
+    }
+
+}} // namespace egret::tests
+
+TEST(bootstrap, single_curve) {
+    const auto parametrization = egret::tests::sample_parametrization();
+    const auto constraints = egret::tests::sample_constraints();
+    const auto result = egret::fit::yc::bootstrap(parametrization, constraints, egret::tests::vdt);
+
+    ASSERT_EQ(result.parameters.size(), 3);
+    ASSERT_EQ(result.residuals.size(), 3);
+    for (const double r : result.residuals) {
+        EXPECT_LT(std::abs(r), 1e-8);
+    }
+    ASSERT_EQ(result.stages.size(), 3);
+    for (const auto& stage : result.stages) {
+        EXPECT_EQ(stage.stage, egret::fit::yc::bootstrap_stage::sequential);
+    }
+
+    // rebuilt curves reproduce the quotes
+    const auto curves = parametrization.build(std::span<const double>(result.parameters));
+    for (const auto& c : constraints) {
+        EXPECT_NEAR(curves.at("OIS").forward_rate(egret::tests::vdt, c.maturity), c.rate, 1e-10);
+    }
+}
+
+TEST(bootstrap, layout_mismatch) {
+    const auto parametrization = egret::tests::sample_parametrization();
+    const auto layout = egret::fit::yc::curve_layout<std::string>(std::vector<std::string> {"OIS", "TONA"});
+    EXPECT_ANY_THROW(egret::fit::yc::bootstrap(parametrization, egret::tests::sample_constraints(), layout, egret::tests::vdt));
+}
+
+TEST(bootstrap, ois_constraints) {
+    const auto parametrization = egret::fit::yc::log_df_parametrization<std::string>(
+        egret::tests::vdt, {{"OIS", egret::tests::swap_pillars}}
+    );
+    const auto constraints = egret::tests::sample_ois_constraints();
+    const auto result = egret::fit::yc::bootstrap(parametrization, constraints, egret::tests::vdt);
+
+    ASSERT_EQ(result.stages.size(), 3);
+    for (const auto& stage : result.stages) {
+        EXPECT_EQ(stage.stage, egret::fit::yc::bootstrap_stage::sequential);
+    }
+    const auto curves = parametrization.build(std::span<const double>(result.parameters));
+    for (const auto& c : constraints) {
+        EXPECT_LT(std::abs(egret::fit::yc::evaluate(c, egret::tests::vdt, curves)), 1e-8);
+    }
+    // rates of the one year swap are compounded daily over a flat forward
+    const auto df = egret::model::discount_factor(curves.at("OIS"), egret::tests::vdt, egret::tests::swap_pillars[0]);
+    EXPECT_NEAR(0.010 * 366. / 365., 1. / df - 1., 1e-10);
+}
+
+TEST(bootstrap, bound_constraints) {
+    const auto parametrization = egret::fit::yc::log_df_parametrization<std::string>(
+        egret::tests::vdt, {{"OIS", egret::tests::swap_pillars}}
+    );
+    const auto layout = egret::fit::yc::curve_layout<std::string>(parametrization.pillars());
+    const auto constraints = egret::tests::sample_ois_constraints();
+    auto bound = std::vector<egret::fit::yc::bind_result_t<decltype(egret::fit::yc::compile(constraints[0])), std::string>> {};
+    for (const auto& c : constraints) {
+        bound.push_back(egret::fit::yc::bind(egret::fit::yc::compile(c), layout));
+    }
+
+    const auto expected = egret::fit::yc::bootstrap(parametrization, constraints, egret::tests::vdt);
+    const auto result = egret::fit::yc::bootstrap(parametrization, bound, layout, egret::tests::vdt);
+    ASSERT_EQ(expected.parameters.size(), result.parameters.size());
+    for (std::size_t i = 0; i != result.parameters.size(); ++i) {
+        EXPECT_NEAR(expected.parameters[i], result.parameters[i], 1e-12);
+        EXPECT_LT(std::abs(result.residuals[i]), 1e-8);
+    }
+}
+
+TEST(bootstrap, coupled_curves) {
+    using curve_t = egret::fit::yc::log_df_parametrization<std::string>::curve_type<>;
+    const auto parametrization = egret::fit::yc::log_df_parametrization<std::string>(
+        egret::tests::vdt, {{"DISC", egret::tests::swap_pillars}, {"TIBOR", egret::tests::swap_pillars}}
+    );
+    const auto constraints = egret::tests::coupled_constraints<curve_t>("DISC", "TIBOR");
+    const auto result = egret::fit::yc::bootstrap(parametrization, constraints, egret::tests::vdt);
+
+    // the discount curve is solved before the projection curve depending on it
+    ASSERT_EQ(result.stages.size(), 6);
+    for (const auto& stage : result.stages) {
+        EXPECT_EQ(stage.stage, egret::fit::yc::bootstrap_stage::sequential);
+    }
+    for (const double r : result.residuals) {
+        EXPECT_LT(std::abs(r), 1e-8);
+    }
+
+    // solving over bound constraints gives the same curves
+    const auto layout = egret::fit::yc::curve_layout<std::string>(parametrization.pillars());
+    auto bound = std::vector<egret::fit::yc::any_bound_evaluator<double, curve_t>> {};
+    for (const auto& c : constraints) {
+        bound.push_back(egret::fit::yc::bind(c, layout));
+    }
+    const auto bound_result = egret::fit::yc::bootstrap(parametrization, bound, layout, egret::tests::vdt);
+    for (std::size_t i = 0; i != result.parameters.size(); ++i) {
+        EXPECT_NEAR(result.parameters[i], bound_result.parameters[i], 1e-12);
+    }
+}
+
+TEST(bootstrap, coupled_curves_out_of_order) {
+    using curve_t = egret::fit::yc::log_df_parametrization<std::string>::curve_type<>;
+    const auto in_order = egret::fit::yc::log_df_parametrization<std::string>(
+        egret::tests::vdt, {{"DISC", egret::tests::swap_pillars}, {"TIBOR", egret::tests::swap_pillars}}
+    );
+    const auto expected = egret::fit::yc::bootstrap(in_order, egret::tests::coupled_constraints<curve_t>("DISC", "TIBOR"), egret::tests::vdt);
+
+    // the projection curve comes first, and is solved on the discount curve not solved yet
+    const auto parametrization = egret::fit::yc::log_df_parametrization<std::string>(
+        egret::tests::vdt, {{"DISC", egret::tests::swap_pillars}, {"ATIBOR", egret::tests::swap_pillars}}
+    );
+    const auto result = egret::fit::yc::bootstrap(parametrization, egret::tests::coupled_constraints<curve_t>("DISC", "ATIBOR"), egret::tests::vdt);
+
+    ASSERT_FALSE(result.stages.empty());
+    EXPECT_EQ(result.stages.back().stage, egret::fit::yc::bootstrap_stage::global);
+    for (const double r : result.residuals) {
+        EXPECT_LT(std::abs(r), 1e-8);
+    }
+    // parameters of ATIBOR come first
+    for (std::size_t i = 0; i != 3; ++i) {
+        EXPECT_NEAR(expected.parameters[i + 3], result.parameters[i], 1e-10);
+        EXPECT_NEAR(expected.parameters[i], result.parameters[i + 3], 1e-10);
+    }
+}
+
+TEST(bootstrap, global_fallback) {
+    const auto parametrization = egret::tests::cspline_parametrization();
+    const auto constraints = egret::tests::off_pillar_constraints();
+    const auto result = egret::fit::yc::bootstrap(parametrization, constraints, egret::tests::vdt);
+
+    ASSERT_EQ(result.stages.size(), 4);
+    EXPECT_EQ(result.stages.back().stage, egret::fit::yc::bootstrap_stage::global);
+    EXPECT_EQ(result.stages.back().pillar, 3);
+    EXPECT_LT(result.stages.back().residual, 1e-8);
+    const auto curves = parametrization.build(std::span<const double>(result.parameters));
+    for (const auto& c : constraints) {
+        EXPECT_NEAR(curves.at("OIS").forward_rate(egret::tests::vdt, c.maturity), c.rate, 1e-8);
+    }
+}
+
+TEST(bootstrap, without_global_fallback) {
+    const auto parametrization = egret::tests::cspline_parametrization();
+    EXPECT_THROW(
+        egret::fit::yc::bootstrap(
+            parametrization, egret::tests::off_pillar_constraints(), egret::tests::vdt,
+            egret::fit::yc::bootstrap_config {.global_fallback = false}
+        ),
+        egret::exception
+    );
+}
@@ -0,0 +1,257 @@
+#include <cmath>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+#include "core/chrono/calendars/calendar.h"
+#include "egret/chrono/daycounters/act365f.h"
+#include "egret/fittings/yc/constraints/any_evaluator.h"
+#include "egret/fittings/yc/constraints/composite_evaluator.h"
+#include "egret/fittings/yc/constraints/scaled_evaluator.h"
+#include "egret/fittings/yc/constraints/irs_constraint.h"
+#include "egret/fittings/yc/constraints/ois_constraint.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    using fixed_leg_t = egret::inst::cfs::fixed_leg<std::string, egret::chrono::act365f_t>;
+    using term_rate_leg_t = egret::inst::cfs::term_rate_leg<std::string, std::string, egret::chrono::act365f_t>;
+    using overnight_index_leg_t = egret::inst::cfs::overnight_index_leg<std::string, std::string, egret::chrono::act365f_t>;
+
+    // instantaneous forward a + b t, t in years from 2024-01-01
+    struct linear_forward_curve {
+        double a;
+        double b;
+
+        double forward_rate(const std::chrono::sys_days& from, const std::chrono::sys_days& to) const
+        {
+            const auto base = std::chrono::sys_days(2024y / 1 / 1);
+            const auto t0 = static_cast<double>((from - base).count()) / 365.;
+            const auto t1 = static_cast<double>((to - base).count()) / 365.;
+            return a + b * (t0 + t1) / 2.;
+        }
+    };
+
+    // evaluator which has no bound form
+    struct forward_rate_constraint {
+        std::string curve;
+        std::chrono::sys_days maturity;
+
+        template <typename Curve>
+        auto evaluate(const std::chrono::sys_days& vdt, const std::map<std::string, Curve>& curves) const
+        {
+            return curves.at(curve).forward_rate(vdt, maturity);
+        }
+    };
+
+    const auto vdt = std::chrono::sys_days(2024y / 5 / 1);
+
+    // "LIBOR" is not referred by the legs, so that slots differ from the positions in the legs
+    const auto curves = std::map<std::string, linear_forward_curve> {
+        {"DISC", {0.01, 0.}},
+        {"LIBOR", {0.03, 0.}},
+        {"OIS", {0.01, 0.04}},
+        {"TIBOR", {0.015, 0.02}},
+    };
+
+    fixed_leg_t sample_fixed_leg()
+    {
+        auto cfs = std::vector<egret::inst::cfs::fixed_rate_cf<>> {};
+        for (const auto& [start, end] : {std::pair {2024y / 4 / 15, 2024y / 10 / 15}, std::pair {2024y / 10 / 15, 2025y / 4 / 15}}) {
+            cfs.push_back({
+                .notional_ratio = 1.,
+                .accrual_start = start,
+                .accrual_end = end,
+                .payment_date = end,
+                .cashout_date = end,
+                .entitlement_date = end,
+                .rate = 0.012,
+            });
+        }
+        return {{.discount_curve = "DISC", .accrual_daycounter = egret::chrono::act365f, .notional = 1e8}, std::move(cfs)};
+    }
+
+    term_rate_leg_t sample_term_rate_leg()
+    {
+        auto cfs = std::vector<egret::inst::cfs::term_rate_cashflow<>> {};
+        for (const auto& [start, end] : {std::pair {2024y / 4 / 15, 2024y / 10 / 15}, std::pair {2024y / 10 / 15, 2025y / 4 / 15}}) {
+            cfs.push_back({
+                .notional_ratio = 1.,
+                .accrual_start = start,
+                .accrual_end = end,
+                .reference_start = start,
+                .reference_end = end,
+                .fixing_date = start,
+                .payment_date = end,
+                .cashout_date = end,
+                .entitlement_date = end,
+                .gearing = 1.,
+                .spread = 0.,
+                .fixed_coupon_rate = std::nullopt,
+            });
+        }
+        return {
+            {
+                .discount_curve = "DISC",
+                .projection_curve = "TIBOR",
+                .rate_daycounter = egret::chrono::act365f,
+                .accrual_daycounter = egret::chrono::act365f,
+                .notional = 1e8,
+            },
+            std::move(cfs)
+        };
+    }
+
+    overnight_index_leg_t sample_overnight_index_leg()
+    {
+        auto cfs = std::vector<egret::inst::cfs::overnight_index_cashflow<>> {};
+        for (const auto& [start, end] : {std::pair {2024y / 4 / 15, 2024y / 10 / 15}, std::pair {2024y / 10 / 15, 2025y / 4 / 15}}) {
+            cfs.push_back({
+                .notional_ratio = 1.,
+                .lookback = std::chrono::days(2),
+                .backward_shift = std::chrono::days(0),
+                .lockout = std::chrono::days(1),
+                .accrual_start = start,
+                .accrual_end = end,
+                .fixing_date = end,
+                .payment_date = end,
+                .cashout_date = end,
+                .entitlement_date = end,
+                .gearing = 1.,
+                .spread = 0.,
+                .fixed_coupon_rate = std::nullopt,
+            });
+        }
+        const auto cal = egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {std::chrono::sys_days(2024y / 5 / 3), std::chrono::sys_days(2024y / 12 / 31)},
+            {}
+        );
+        return {
+            {
+                .discount_curve = "DISC",
+                .projection_curve = "OIS",
+                .rate_daycounter = egret::chrono::act365f,
+                .accrual_daycounter = egret::chrono::act365f,
+                .rate_reference_calendar = cal,
+                .notional = 1e8,
+            },
+            std::move(cfs)
+        };
+    }
+
+    // evaluates by the map and by the flat array of curves bound to the layout of the map
+    template <typename Evaluator>
+    void expect_bound_equals_map(const Evaluator& evaluator)
+    {
+        const auto layout = egret::fit::yc::curve_layout<std::string>(curves);
+        const auto arranged = layout.arrange(curves);
+        const auto bound = egret::fit::yc::bind(evaluator, layout);
+
+        const double expected = egret::fit::yc::evaluate(evaluator, vdt, curves);
+        EXPECT_NE(0., expected);
+        EXPECT_DOUBLE_EQ(expected, egret::fit::yc::evaluate(bound, vdt, std::span<const linear_forward_curve>(arranged)));
+    }
+
+}} // namespace egret::tests
+
+TEST(curve_layout, sorts_and_deduplicates_tags) {
+    const auto layout = egret::fit::yc::curve_layout<std::string>(std::vector<std::string> {"TIBOR", "DISC", "OIS", "DISC"});
+
+    EXPECT_EQ((std::vector<std::string> {"DISC", "OIS", "TIBOR"}), layout.tags());
+    EXPECT_EQ(3, layout.size());
+    EXPECT_EQ(0, layout.slot("DISC").index);
+    EXPECT_EQ(1, layout.slot(std::string("OIS")).index);
+    EXPECT_EQ(2, layout.slot("TIBOR").index);
+    EXPECT_THROW(layout.slot("TONA"), egret::exception);
+}
+
+TEST(curve_layout, agrees_with_map_order) {
+    const auto layout = egret::fit::yc::curve_layout<std::string>(egret::tests::curves);
+    const auto arranged = layout.arrange(egret::tests::curves);
+
+    ASSERT_EQ(egret::tests::curves.size(), arranged.size());
+    for (const auto& [tag, curve] : egret::tests::curves) {
+        EXPECT_EQ(curve.a, arranged[layout.slot(tag).index].a);
+        EXPECT_EQ(curve.b, arranged[layout.slot(tag).index].b);
+    }
+}
+
+TEST(curve_layout, arrange_throws_on_missing_curve) {
+    const auto layout = egret::fit::yc::curve_layout<std::string>(std::vector<std::string> {"DISC", "TONA"});
+    EXPECT_THROW(layout.arrange(egret::tests::curves), egret::exception);
+}
+
+TEST(bind, fixed_leg) {
+    egret::tests::expect_bound_equals_map(egret::tests::sample_fixed_leg());
+}
+
+TEST(bind, term_rate_leg) {
+    egret::tests::expect_bound_equals_map(egret::tests::sample_term_rate_leg());
+}
+
+TEST(bind, overnight_index_leg) {
+    const auto leg = egret::tests::sample_overnight_index_leg();
+    egret::tests::expect_bound_equals_map(leg);
+    egret::tests::expect_bound_equals_map(egret::fit::yc::compile(leg));
+}
+
+TEST(bind, swap_constraints) {
+    const auto irs = egret::fit::yc::irs_constraint<std::string, std::string, egret::chrono::act365f_t>(
+        egret::tests::sample_term_rate_leg(), egret::tests::sample_fixed_leg()
+    );
+    egret::tests::expect_bound_equals_map(irs);
+
+    const auto ois = egret::fit::yc::ois_constraint<std::string, std::string, egret::chrono::act365f_t>(
+        egret::tests::sample_overnight_index_leg(), egret::tests::sample_fixed_leg()
+    );
+    const auto compiled = egret::fit::yc::compile(ois);
+    EXPECT_NEAR(
+        egret::fit::yc::evaluate(ois, egret::tests::vdt, egret::tests::curves),
+        egret::fit::yc::evaluate(compiled, egret::tests::vdt, egret::tests::curves),
+        1e-6
+    );
+    egret::tests::expect_bound_equals_map(ois);
+    egret::tests::expect_bound_equals_map(compiled);
+}
+
+TEST(bind, composite_and_scaled_evaluators) {
+    const auto composite = egret::fit::yc::composite_evaluator<egret::tests::fixed_leg_t>(
+        {egret::tests::sample_fixed_leg(), egret::tests::sample_fixed_leg()}
+    );
+    egret::tests::expect_bound_equals_map(composite);
+    egret::tests::expect_bound_equals_map(egret::fit::yc::scaled_evaluator(egret::tests::sample_term_rate_leg(), 0.5));
+    egret::tests::expect_bound_equals_map(egret::fit::yc::scaled_evaluator(composite, -2.));
+}
+
+TEST(bind, any_evaluator) {
+    using any_t = egret::fit::yc::any_evaluator<double, std::string, egret::tests::linear_forward_curve>;
+    const auto evaluator = any_t(egret::tests::sample_overnight_index_leg());
+    egret::tests::expect_bound_equals_map(evaluator);
+
+    // the bound form keeps the bound evaluator
+    const auto layout = egret::fit::yc::curve_layout<std::string>(egret::tests::curves);
+    const auto bound = egret::fit::yc::bind(evaluator, layout);
+    using bound_leg_t = egret::fit::yc::bind_result_t<egret::tests::overnight_index_leg_t, std::string>;
+    EXPECT_TRUE(bound.as<bound_leg_t>().has_value());
+    EXPECT_FALSE(bound.as<egret::tests::overnight_index_leg_t>().has_value());
+}
+
+TEST(bind, throws_on_missing_tag) {
+    const auto layout = egret::fit::yc::curve_layout<std::string>(std::vector<std::string> {"DISC", "TONA"});
+    EXPECT_THROW(egret::fit::yc::bind(egret::tests::sample_term_rate_leg(), layout), egret::exception);
+    EXPECT_THROW(egret::fit::yc::bind(egret::fit::yc::compile(egret::tests::sample_overnight_index_leg()), layout), egret::exception);
+    EXPECT_NO_THROW(egret::fit::yc::bind(egret::tests::sample_fixed_leg(), layout));
+}
+
+TEST(bind, any_evaluator_throws_if_unbindable) {
+    using namespace std::chrono_literals;
+    using any_t = egret::fit::yc::any_evaluator<double, std::string, egret::tests::linear_forward_curve>;
+    const auto evaluator = any_t(egret::tests::forward_rate_constraint {"OIS", std::chrono::sys_days(2025y / 1 / 15)});
+    const auto layout = egret::fit::yc::curve_layout<std::string>(egret::tests::curves);
+    EXPECT_NO_THROW(egret::fit::yc::evaluate(evaluator, egret::tests::vdt, egret::tests::curves));
+    EXPECT_THROW(egret::fit::yc::bind(evaluator, layout), egret::exception);
+}
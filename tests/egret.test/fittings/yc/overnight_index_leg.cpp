@@ -0,0 +1,207 @@
+#include <cmath>
+#include <map>
+#include <string>
+#include "core/chrono/calendars/calendar.h"
+#include "egret/chrono/daycounters/act365f.h"
+#include "egret/fittings/yc/constraints/overnight_index_leg.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    using header_t = egret::inst::cfs::overnight_index_leg_header<std::string, std::string, egret::chrono::act365f_t>;
+    using cashflow_t = egret::inst::cfs::overnight_index_cashflow<>;
+    using leg_t = egret::inst::cfs::overnight_index_leg<std::string, std::string, egret::chrono::act365f_t>;
+
+    egret::chrono::calendar sample_calendar()
+    {
+        return egret::chrono::calendar(
+            egret::chrono::calendar_identifier(std::set<std::string> {"TEST"}),
+            {
+                std::chrono::sys_days(2024y / 1 / 1),
+                std::chrono::sys_days(2024y / 5 / 3),
+                std::chrono::sys_days(2024y / 12 / 31),
+            },
+            {}
+        );
+    }
+
+    // instantaneous forward a + b t, t in years from 2024-01-01
+    struct linear_forward_curve {
+        double a;
+        double b;
+
+        double forward_rate(const std::chrono::sys_days& from, const std::chrono::sys_days& to) const
+        {
+            const auto base = std::chrono::sys_days(2024y / 1 / 1);
+            const auto t0 = static_cast<double>((from - base).count()) / 365.;
+            const auto t1 = static_cast<double>((to - base).count()) / 365.;
+            return a + b * (t0 + t1) / 2.;
+        }
+    };
+
+    header_t sample_header()
+    {
+        return {
+            .discount_curve = "DISC",
+            .projection_curve = "OIS",
+            .rate_daycounter = egret::chrono::act365f,
+            .accrual_daycounter = egret::chrono::act365f,
+            .rate_reference_calendar = sample_calendar(),
+            .notional = 1e8,
+        };
+    }
+
+    cashflow_t sample_cashflow(int lookback, int backward_shift, int lockout)
+    {
+        return {
+            .notional_ratio = 1.,
+            .lookback = std::chrono::days(lookback),
+            .backward_shift = std::chrono::days(backward_shift),
+            .lockout = std::chrono::days(lockout),
+            .accrual_start = 2024y / 4 / 15,
+            .accrual_end = 2024y / 7 / 15,
+            .fixing_date = 2024y / 7 / 15,
+            .payment_date = 2024y / 7 / 17,
+            .cashout_date = 2024y / 7 / 17,
+            .entitlement_date = 2024y / 7 / 16,
+            .gearing = 1.,
+            .spread = 0.,
+            .fixed_coupon_rate = std::nullopt,
+        };
+    }
+
+// -----------------------------------------------------------------------------
+//  compounded
+// -----------------------------------------------------------------------------
+    struct observed_steps {
+        std::vector<double> fwds;
+        std::vector<double> fwd_dcfs;
+        std::vector<double> weight_dcfs;
+        double period_dcf;
+    };
+
+    // daily steps of a coupon without lockout, walked independently of the implementation
+    observed_steps walk(const egret::chrono::calendar& cal, const linear_forward_curve& curve, const cashflow_t& cf)
+    {
+        const auto lookback = static_cast<std::int_fast32_t>(cf.lookback.count());
+        const auto shift = static_cast<std::int_fast32_t>(cf.backward_shift.count());
+        const auto weight_start = egret::chrono::add_businessdays(cal, cf.accrual_start, -shift);
+        const auto per_end = egret::chrono::add_businessdays(cal, cf.accrual_end, -shift - lookback);
+
+        auto result = observed_steps {};
+        auto w = weight_start;
+        for (auto r = egret::chrono::add_businessdays(cal, weight_start, -lookback); r < per_end; ) {
+            const auto r_next = egret::chrono::add_businessdays(cal, r, 1);
+            const auto w_next = egret::chrono::add_businessdays(cal, w, 1);
+            result.fwds.push_back(curve.forward_rate(r, r_next));
+            result.fwd_dcfs.push_back(static_cast<double>((r_next - r).count()) / 365.);
+            result.weight_dcfs.push_back(static_cast<double>((w_next - w).count()) / 365.);
+            r = r_next;
+            w = w_next;
+        }
+        result.period_dcf = static_cast<double>((w - weight_start).count()) / 365.;
+        return result;
+    }
+
+    double daily_product(const observed_steps& steps)
+    {
+        double result = 1.;
+        for (std::size_t i = 0; i != steps.fwds.size(); ++i) {
+            const auto growth = std::exp(steps.fwds[i] * steps.fwd_dcfs[i]);
+            result *= 1. + (growth - 1.) / steps.fwd_dcfs[i] * steps.weight_dcfs[i];
+        }
+        return result;
+    }
+
+    // compounded factor implied by the present value of a coupon with gearing 1 and no spread
+    double implied_compounded(double pv, const header_t& header, const cashflow_t& cf, const linear_forward_curve& dcurve, double period_dcf)
+    {
+        const auto df = egret::model::discount_factor(dcurve, cf.accrual_start, cf.payment_date);
+        const auto dcf = egret::chrono::dcf(header.accrual_daycounter, cf.accrual_start, cf.accrual_end);
+        return 1. + pv / (df * header.notional * dcf) * period_dcf;
+    }
+
+}} // namespace egret::tests
+
+TEST(overnight_index_leg, exact_without_lookback_equals_daily_product) {
+    const auto header = egret::tests::sample_header();
+    const auto cf = egret::tests::sample_cashflow(0, 0, 0);
+    const auto curves = std::map<std::string, egret::tests::linear_forward_curve> {
+        {"DISC", {0.01, 0.}},
+        {"OIS", {0.01, 0.04}},
+    };
+    const auto vdt = cf.accrual_start;
+    const auto steps = egret::tests::walk(header.rate_reference_calendar, curves.at("OIS"), cf);
+
+    // telescoped into a single discount factor
+    const auto plan = egret::fit::yc::compile(egret::tests::leg_t(header, {cf}));
+    EXPECT_TRUE(plan.coupons().front().summarized);
+    const auto compounded = egret::tests::implied_compounded(plan.evaluate(vdt, curves), header, cf, curves.at("DISC"), steps.period_dcf);
+    EXPECT_NEAR(egret::tests::daily_product(steps), compounded, 1e-13);
+}
+
+TEST(overnight_index_leg, approximate_error_on_shifted_coupon) {
+    const auto header = egret::tests::sample_header();
+    const auto cf = egret::tests::sample_cashflow(2, 0, 0);
+    const auto leg = egret::tests::leg_t(header, {cf});
+    const auto exact = egret::fit::yc::compile(leg, egret::fit::yc::overnight_index_compounding::exact);
+    const auto approx = egret::fit::yc::compile(leg, egret::fit::yc::overnight_index_compounding::approximate);
+    const auto vdt = cf.accrual_start;
+
+    // flat and sloped forwards
+    for (const auto& ois : {egret::tests::linear_forward_curve {0.05, 0.}, egret::tests::linear_forward_curve {0.01, 0.04}}) {
+        const auto curves = std::map<std::string, egret::tests::linear_forward_curve> {
+            {"DISC", {0.01, 0.}},
+            {"OIS", ois},
+        };
+        const auto steps = egret::tests::walk(header.rate_reference_calendar, ois, cf);
+        const auto exact_compounded = egret::tests::implied_compounded(exact.evaluate(vdt, curves), header, cf, curves.at("DISC"), steps.period_dcf);
+        const auto approx_compounded = egret::tests::implied_compounded(approx.evaluate(vdt, curves), header, cf, curves.at("DISC"), steps.period_dcf);
+        EXPECT_NEAR(egret::tests::daily_product(steps), exact_compounded, 1e-13);
+
+        // the documented error: sum (f_i - f) (w_i - tau_i W / T) + f^2 / 2 sum w_i (tau_i - w_i)
+        const auto n = static_cast<double>(steps.fwds.size());
+        double mean = 0., w_sum = 0., tau_sum = 0.;
+        for (std::size_t i = 0; i != steps.fwds.size(); ++i) {
+            mean += steps.fwds[i] / n;
+            w_sum += steps.weight_dcfs[i];
+            tau_sum += steps.fwd_dcfs[i];
+        }
+        double error = 0.;
+        for (std::size_t i = 0; i != steps.fwds.size(); ++i) {
+            const auto w = steps.weight_dcfs[i];
+            const auto tau = steps.fwd_dcfs[i];
+            error += (steps.fwds[i] - mean) * (w - tau * w_sum / tau_sum) + mean * mean / 2. * w * (tau - w);
+        }
+        const auto actual = std::log(exact_compounded) - std::log(approx_compounded);
+        EXPECT_NE(0., actual);
+        EXPECT_NEAR(error, actual, 0.01 * std::abs(error));
+    }
+}
+
+TEST(overnight_index_leg, cashflow_evaluator_consistent_with_compile) {
+    using namespace std::chrono_literals;
+    const auto header = egret::tests::sample_header();
+    const auto curves = std::map<std::string, egret::tests::linear_forward_curve> {
+        {"DISC", {0.01, 0.}},
+        {"OIS", {0.01, 0.04}},
+    };
+    const auto evaluator = egret::fit::yc::cashflow_evaluator<egret::tests::header_t, egret::tests::cashflow_t> {};
+
+    for (const auto lookback : {0, 2}) {
+        for (const auto shift : {0, 2}) {
+            for (const auto lockout : {0, 2}) {
+                const auto cf = egret::tests::sample_cashflow(lookback, shift, lockout);
+                const auto plan = egret::fit::yc::compile(egret::tests::leg_t(header, {cf}));
+                for (const auto vdt : {std::chrono::sys_days(2024y / 3 / 1), std::chrono::sys_days(2024y / 5 / 1)}) {
+                    const auto expected = plan.evaluate(vdt, curves);
+                    EXPECT_NEAR(expected, evaluator(header, cf, vdt, curves), 1e-12 * std::abs(expected))
+                        << "lookback=" << lookback << ", shift=" << shift << ", lockout=" << lockout;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#include <cmath>
+#include <map>
+#include <optional>
+#include <string>
+#include "egret/chrono/daycounters/act365f.h"
+#include "egret/fittings/yc/constraints/term_rate_leg.h"
+
+namespace egret::tests { namespace {
+// -----------------------------------------------------------------------------
+//  sample data
+// -----------------------------------------------------------------------------
+    using namespace std::chrono_literals;
+
+    using header_t = egret::inst::cfs::term_rate_leg_header<std::string, std::string, egret::chrono::act365f_t>;
+    using cashflow_t = egret::inst::cfs::term_rate_cashflow<>;
+
+    // instantaneous forward a + b t, t in years from 2024-01-01
+    struct linear_forward_curve {
+        double a;
+        double b;
+
+        double forward_rate(const std::chrono::sys_days& from, const std::chrono::sys_days& to) const
+        {
+            const auto base = std::chrono::sys_days(2024y / 1 / 1);
+            const auto t0 = static_cast<double>((from - base).count()) / 365.;
+            const auto t1 = static_cast<double>((to - base).count()) / 365.;
+            return a + b * (t0 + t1) / 2.;
+        }
+    };
+
+    header_t sample_header()
+    {
+        return {
+            .discount_curve = "DISC",
+            .projection_curve = "TIBOR",
+            .rate_daycounter = egret::chrono::act365f,
+            .accrual_daycounter = egret::chrono::act365f,
+            .notional = 1e8,
+        };
+    }
+
+    // the reference period is set apart from the accrual period, so that their forwards differ
+    cashflow_t sample_cashflow()
+    {
+        return {
+            .notional_ratio = 1.,
+            .accrual_start = 2024y / 4 / 15,
+            .accrual_end = 2024y / 7 / 15,
+            .reference_start = 2024y / 10 / 15,
+            .reference_end = 2025y / 4 / 15,
+            .fixing_date = 2024y / 4 / 11,
+            .payment_date = 2024y / 7 / 17,
+            .cashout_date = 2024y / 7 / 17,
+            .entitlement_date = 2024y / 7 / 16,
+            .gearing = 2.,
+            .spread = 0.001,
+            .fixed_coupon_rate = std::nullopt,
+        };
+    }
+
+    const auto curves = std::map<std::string, linear_forward_curve> {
+        {"DISC", {0.01, 0.}},
+        {"TIBOR", {0.01, 0.04}},
+    };
+
+}} // namespace egret::tests
+
+TEST(term_rate_leg, projects_over_reference_period) {
+    using namespace std::chrono_literals;
+    const auto header = egret::tests::sample_header();
+    const auto cf = egret::tests::sample_cashflow();
+    const auto vdt = std::chrono::sys_days(2024y / 5 / 1);
+    const auto& dcurve = egret::tests::curves.at("DISC");
+    const auto& pcurve = egret::tests::curves.at("TIBOR");
+
+    const auto ref_dcf = static_cast<double>((cf.reference_end - cf.reference_start).count()) / 365.;
+    const auto fwd = (std::exp(pcurve.forward_rate(cf.reference_start, cf.reference_end) * ref_dcf) - 1.) / ref_dcf;
+    const auto dcf = static_cast<double>((cf.accrual_end - cf.accrual_start).count()) / 365.;
+    const auto df = egret::model::discount_factor(dcurve, vdt, cf.payment_date);
+    const auto expected = df * header.notional * dcf * (fwd * 2. + 0.001);
+
+    const auto evaluator = egret::fit::yc::cashflow_evaluator<egret::tests::header_t, egret::tests::cashflow_t> {};
+    EXPECT_NEAR(expected, evaluator(header, cf, vdt, egret::tests::curves), 1e-12 * std::abs(expected));
+}
+
+TEST(term_rate_leg, fixed_coupon_ignores_projection) {
+    using namespace std::chrono_literals;
+    const auto header = egret::tests::sample_header();
+    auto cf = egret::tests::sample_cashflow();
+    cf.fixed_coupon_rate = 0.02;
+    const auto vdt = std::chrono::sys_days(2024y / 5 / 1);
+
+    const auto dcf = static_cast<double>((cf.accrual_end - cf.accrual_start).count()) / 365.;
+    const auto df = egret::model::discount_factor(egret::tests::curves.at("DISC"), vdt, cf.payment_date);
+    const auto expected = df * header.notional * dcf * 0.02;
+
+    const auto evaluator = egret::fit::yc::cashflow_evaluator<egret::tests::header_t, egret::tests::cashflow_t> {};
+    EXPECT_NEAR(expected, evaluator(header, cf, vdt, egret::tests::curves), 1e-12 * std::abs(expected));
+}
+
+TEST(term_rate_leg, missing_projection_curve) {
+    using namespace std::chrono_literals;
+    auto header = egret::tests::sample_header();
+    header.projection_curve = "TONA";
+    const auto evaluator = egret::fit::yc::cashflow_evaluator<egret::tests::header_t, egret::tests::cashflow_t> {};
+    EXPECT_THROW(
+        evaluator(header, egret::tests::sample_cashflow(), std::chrono::sys_days(2024y / 3 / 1), egret::tests::curves),
+        egret::exception
+    );
+}